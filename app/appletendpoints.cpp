@@ -0,0 +1,200 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "appletendpoints.h"
+
+// local
+#include "layoutmanager.h"
+#include "layout/layout.h"
+
+// Qt
+#include <QDebug>
+
+// Plasma
+#include <Plasma/Applet>
+#include <Plasma/Containment>
+#include <PlasmaQuick/AppletQuickItem>
+
+namespace Latte {
+
+namespace {
+//! "var" arguments are treated as QVariant in QMetaObject
+QMetaMethod resolveMethod(const QMetaObject *metaObject, const char *signature)
+{
+    int methodIndex = metaObject->indexOfMethod(signature);
+
+    return methodIndex == -1 ? QMetaMethod() : metaObject->method(methodIndex);
+}
+}
+
+AppletEndpoints::AppletEndpoints(QObject *parent)
+    : QObject(parent)
+{
+    m_manager = qobject_cast<LayoutManager *>(parent);
+}
+
+AppletEndpoints::~AppletEndpoints()
+{
+    m_tasksEndpoints.clear();
+    m_containmentEndpoints.clear();
+}
+
+Plasma::Applet *AppletEndpoints::appletForItem(QQuickItem *item) const
+{
+    for (QQuickItem *parent = item ? item->parentItem() : nullptr; parent; parent = parent->parentItem()) {
+        if (auto *appletItem = qobject_cast<PlasmaQuick::AppletQuickItem *>(parent)) {
+            return appletItem->applet();
+        }
+    }
+
+    return nullptr;
+}
+
+void AppletEndpoints::registerTasksPlasmoid(QQuickItem *item)
+{
+    if (!item || m_tasksEndpoints.contains(item)) {
+        return;
+    }
+
+    Plasma::Applet *applet = appletForItem(item);
+
+    if (!applet) {
+        qWarning() << "Latte tasks plasmoid endpoint could not be identified...";
+        return;
+    }
+
+    const QMetaObject *metaObject = item->metaObject();
+
+    TasksEndpoint endpoint;
+    endpoint.item = item;
+    endpoint.applet = applet;
+    endpoint.addLauncher = resolveMethod(metaObject, "extSignalAddLauncher(QVariant,QVariant)");
+    endpoint.removeLauncher = resolveMethod(metaObject, "extSignalRemoveLauncher(QVariant,QVariant)");
+    endpoint.addLauncherToActivity = resolveMethod(metaObject, "extSignalAddLauncherToActivity(QVariant,QVariant,QVariant)");
+    endpoint.removeLauncherFromActivity = resolveMethod(metaObject, "extSignalRemoveLauncherFromActivity(QVariant,QVariant,QVariant)");
+    endpoint.urlsDropped = resolveMethod(metaObject, "extSignalUrlsDropped(QVariant,QVariant)");
+    endpoint.moveTask = resolveMethod(metaObject, "extSignalMoveTask(QVariant,QVariant,QVariant)");
+    endpoint.validateLaunchersOrder = resolveMethod(metaObject, "extSignalValidateLaunchersOrder(QVariant,QVariant)");
+    endpoint.updateBadge = resolveMethod(metaObject, "updateBadge(QVariant,QVariant)");
+
+    int tasksModelIndex = metaObject->indexOfProperty("tasksModel");
+
+    if (tasksModelIndex >= 0) {
+        endpoint.tasksModel = metaObject->property(tasksModelIndex);
+    }
+
+    m_tasksEndpoints[item] = endpoint;
+
+    connect(item, &QObject::destroyed, this, [&, item]() {
+        m_tasksEndpoints.remove(item);
+    });
+
+    qDebug() << "Latte tasks plasmoid endpoint registered ::: " << applet->id();
+}
+
+void AppletEndpoints::registerContainment(QQuickItem *item)
+{
+    Plasma::Containment *containment = qobject_cast<Plasma::Containment *>(appletForItem(item));
+
+    if (!containment) {
+        qWarning() << "Latte containment endpoint could not be identified...";
+        return;
+    }
+
+    if (m_containmentEndpoints.contains(containment) && m_containmentEndpoints[containment].item == item) {
+        return;
+    }
+
+    const QMetaObject *metaObject = item->metaObject();
+
+    ContainmentEndpoint endpoint;
+    endpoint.item = item;
+    endpoint.containment = containment;
+    endpoint.activateEntryAtIndex = resolveMethod(metaObject, "activateEntryAtIndex(QVariant)");
+    endpoint.newInstanceForEntryAtIndex = resolveMethod(metaObject, "newInstanceForEntryAtIndex(QVariant)");
+    endpoint.setShowAppletShortcutBadges = resolveMethod(metaObject, "setShowAppletShortcutBadges(QVariant,QVariant,QVariant,QVariant)");
+
+    m_containmentEndpoints[containment] = endpoint;
+
+    connect(item, &QObject::destroyed, this, [&, containment, item]() {
+        if (m_containmentEndpoints.contains(containment) && m_containmentEndpoints[containment].item.isNull()) {
+            m_containmentEndpoints.remove(containment);
+        }
+    });
+
+    qDebug() << "Latte containment endpoint registered ::: " << containment->id();
+}
+
+void AppletEndpoints::unregisterEndpoint(QQuickItem *item)
+{
+    if (!item) {
+        return;
+    }
+
+    m_tasksEndpoints.remove(item);
+
+    for (auto it = m_containmentEndpoints.begin(); it != m_containmentEndpoints.end(); ++it) {
+        if (it.value().item == item) {
+            m_containmentEndpoints.erase(it);
+            break;
+        }
+    }
+}
+
+QList<TasksEndpoint> AppletEndpoints::tasksEndpoints(const QString &layoutName) const
+{
+    QList<TasksEndpoint> endpoints;
+    QList<Plasma::Containment *> *containments{nullptr};
+
+    if (!layoutName.isEmpty()) {
+        Layout *layout = m_manager ? m_manager->activeLayout(layoutName) : nullptr;
+
+        if (!layout) {
+            return endpoints;
+        }
+
+        containments = layout->containments();
+    }
+
+    for (const auto &endpoint : m_tasksEndpoints) {
+        if (!endpoint.item || !endpoint.applet) {
+            continue;
+        }
+
+        if (containments && !containments->contains(endpoint.applet->containment())) {
+            continue;
+        }
+
+        endpoints.append(endpoint);
+    }
+
+    return endpoints;
+}
+
+bool AppletEndpoints::hasContainmentEndpoint(const Plasma::Containment *containment) const
+{
+    return m_containmentEndpoints.contains(containment) && m_containmentEndpoints[containment].item;
+}
+
+ContainmentEndpoint AppletEndpoints::containmentEndpoint(const Plasma::Containment *containment) const
+{
+    return m_containmentEndpoints.value(containment);
+}
+
+}
@@ -0,0 +1,109 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef APPLETENDPOINTS_H
+#define APPLETENDPOINTS_H
+
+// Qt
+#include <QHash>
+#include <QMetaMethod>
+#include <QMetaProperty>
+#include <QObject>
+#include <QPointer>
+#include <QQuickItem>
+
+namespace Plasma {
+class Applet;
+class Containment;
+}
+
+namespace Latte {
+class LayoutManager;
+}
+
+namespace Latte {
+
+//! the c++ side entry points of a Latte tasks plasmoid, all of them are
+//! resolved once during registration
+struct TasksEndpoint {
+    QPointer<QQuickItem> item;
+    QPointer<Plasma::Applet> applet;
+
+    QMetaMethod addLauncher;
+    QMetaMethod removeLauncher;
+    QMetaMethod addLauncherToActivity;
+    QMetaMethod removeLauncherFromActivity;
+    QMetaMethod urlsDropped;
+    QMetaMethod moveTask;
+    QMetaMethod validateLaunchersOrder;
+    QMetaMethod updateBadge;
+
+    //! plasmoids with the same synced launchers can share their tasks model
+    QMetaProperty tasksModel;
+};
+
+//! the c++ side entry points of a Latte containment, all of them are
+//! resolved once during registration
+struct ContainmentEndpoint {
+    QPointer<QQuickItem> item;
+    QPointer<Plasma::Containment> containment;
+
+    QMetaMethod activateEntryAtIndex;
+    QMetaMethod newInstanceForEntryAtIndex;
+    QMetaMethod setShowAppletShortcutBadges;
+};
+
+//! Latte plasmoids and containments register their qml entry points here
+//! when they are loaded. This way the broadcasts from LaunchersSignals and
+//! GlobalShortcuts do not need to scan the applets qml trees and resolve
+//! their methods through reflection for every call
+class AppletEndpoints : public QObject
+{
+    Q_OBJECT
+
+public:
+    AppletEndpoints(QObject *parent);
+    ~AppletEndpoints() override;
+
+    //! the registered Latte tasks plasmoids for the active layout with that
+    //! name, an empty name returns the plasmoids of all layouts
+    QList<TasksEndpoint> tasksEndpoints(const QString &layoutName = QString()) const;
+
+    bool hasContainmentEndpoint(const Plasma::Containment *containment) const;
+    ContainmentEndpoint containmentEndpoint(const Plasma::Containment *containment) const;
+
+public slots:
+    Q_INVOKABLE void registerTasksPlasmoid(QQuickItem *item);
+    Q_INVOKABLE void registerContainment(QQuickItem *item);
+    Q_INVOKABLE void unregisterEndpoint(QQuickItem *item);
+
+private:
+    //! the applet that the qml item is the root ui item of
+    Plasma::Applet *appletForItem(QQuickItem *item) const;
+
+private:
+    QHash<QQuickItem *, TasksEndpoint> m_tasksEndpoints;
+    QHash<const Plasma::Containment *, ContainmentEndpoint> m_containmentEndpoints;
+
+    LayoutManager *m_manager{nullptr};
+};
+
+}
+
+#endif
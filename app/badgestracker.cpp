@@ -0,0 +1,85 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "badgestracker.h"
+
+// local
+#include "lattecorona.h"
+#include "shortcuts/globalshortcuts.h"
+
+// Qt
+#include <QDebug>
+
+namespace Latte {
+
+//! one frame at 60Hz
+const int BADGESAPPLYINTERVAL = 16;
+
+BadgesTracker::BadgesTracker(Latte::Corona *parent)
+    : QObject(parent),
+      m_corona(parent)
+{
+    m_applyTimer.setSingleShot(true);
+    m_applyTimer.setInterval(BADGESAPPLYINTERVAL);
+    connect(&m_applyTimer, &QTimer::timeout, this, &BadgesTracker::applyPendingBadges);
+}
+
+BadgesTracker::~BadgesTracker()
+{
+    m_applyTimer.stop();
+}
+
+void BadgesTracker::updateBadge(const QString &identifier, const QString &value)
+{
+    if (identifier.isEmpty()) {
+        return;
+    }
+
+    //! a newer value for the same identifier replaces the pending one
+    m_pendingBadges[identifier] = value;
+
+    //! the timer is not restarted in order to not postpone forever
+    //! the update when an application floods the dbus interface
+    if (!m_applyTimer.isActive()) {
+        m_applyTimer.start();
+    }
+}
+
+void BadgesTracker::updateBadges(const QVariantMap &badges)
+{
+    for (auto it = badges.constBegin(); it != badges.constEnd(); ++it) {
+        updateBadge(it.key(), it.value().toString());
+    }
+}
+
+void BadgesTracker::applyPendingBadges()
+{
+    if (!m_corona || !m_corona->globalShortcuts()) {
+        return;
+    }
+
+    QHash<QString, QString> badges;
+    badges.swap(m_pendingBadges);
+
+    for (auto it = badges.constBegin(); it != badges.constEnd(); ++it) {
+        m_corona->globalShortcuts()->updateViewItemBadge(it.key(), it.value());
+    }
+}
+
+}
@@ -0,0 +1,66 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef BADGESTRACKER_H
+#define BADGESTRACKER_H
+
+// Qt
+#include <QHash>
+#include <QObject>
+#include <QTimer>
+#include <QVariantMap>
+
+namespace Latte {
+class Corona;
+}
+
+namespace Latte {
+
+//! Applications can update their tasks badges through the Latte dbus interface.
+//! Messaging clients tend to send their unread counters several times per second,
+//! so the updates are coalesced and only the latest value for each identifier is
+//! applied once per frame. Unity LauncherEntry counters are not handled here, the
+//! tasks plasmoid tracks them on its own and keeps them apart from these badges
+class BadgesTracker : public QObject
+{
+    Q_OBJECT
+
+public:
+    BadgesTracker(Latte::Corona *parent);
+    ~BadgesTracker() override;
+
+public slots:
+    //! identifier is the application desktop file name without the .desktop suffix
+    void updateBadge(const QString &identifier, const QString &value);
+    void updateBadges(const QVariantMap &badges);
+
+private slots:
+    void applyPendingBadges();
+
+private:
+    QHash<QString, QString> m_pendingBadges;
+
+    QTimer m_applyTimer;
+
+    Latte::Corona *m_corona{nullptr};
+};
+
+}
+
+#endif
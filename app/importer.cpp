@@ -172,6 +172,7 @@ bool Importer::importOldLayout(QString oldAppletsPath, QString newName, bool alt
     Layout newLayout(this, newLayoutPath, newName);
     newLayout.setVersion(2);
     newLayout.setLaunchers(layoutLaunchers);
+    newLayout.launchersStore()->flush();
 
     newLayout.setShowInMenu(true);
 
@@ -22,20 +22,28 @@
 
 // local
 #include "alternativeshelper.h"
+#include "badgestracker.h"
 #include "importer.h"
 #include "lattedockadaptor.h"
+#include "lattedockstatsadaptor.h"
 #include "launcherssignals.h"
 #include "layoutmanager.h"
+#include "qmlcomponentscache.h"
 #include "screenpool.h"
+#include "screentopology.h"
+#include "statsservice.h"
 #include "shortcuts/globalshortcuts.h"
 #include "package/lattepackage.h"
 #include "plasma/extended/screenpool.h"
 #include "plasma/extended/theme.h"
 #include "settings/universalsettings.h"
+#include "view/maskcache.h"
 #include "view/view.h"
 #include "wm/abstractwindowinterface.h"
+#include "wm/simulatedwindowinterface.h"
 #include "wm/waylandinterface.h"
 #include "wm/xwindowinterface.h"
+#include "../liblatte2/tracer.h"
 
 // Qt
 #include <QAction>
@@ -43,7 +51,6 @@
 #include <QScreen>
 #include <QDBusConnection>
 #include <QDebug>
-#include <QDesktopWidget>
 #include <QFile>
 #include <QFontDatabase>
 #include <QQmlContext>
@@ -72,22 +79,32 @@
 
 namespace Latte {
 
-Corona::Corona(bool defaultLayoutOnStartup, QString layoutNameOnStartUp, int userSetMemoryUsage, QObject *parent)
+Corona::Corona(bool defaultLayoutOnStartup, QString layoutNameOnStartUp, int userSetMemoryUsage, QString simulatedWindowSystemScript, QObject *parent)
     : Plasma::Corona(parent),
       m_defaultLayoutOnStartup(defaultLayoutOnStartup),
       m_userSetMemoryUsage(userSetMemoryUsage),
       m_layoutNameOnStartUp(layoutNameOnStartUp),
       m_activityConsumer(new KActivities::Consumer(this)),
       m_screenPool(new ScreenPool(KSharedConfig::openConfig(), this)),
+      m_screenTopology(new ScreenTopology(m_screenPool, this)),
       m_universalSettings(new UniversalSettings(KSharedConfig::openConfig(), this)),
       m_globalShortcuts(new GlobalShortcuts(this)),
+      m_badgesTracker(new BadgesTracker(this)),
       m_plasmaScreenPool(new PlasmaExtended::ScreenPool(this)),
       m_themeExtended(new PlasmaExtended::Theme(KSharedConfig::openConfig(), this)),
-      m_layoutManager(new LayoutManager(this))
+      m_maskCache(new ViewPart::MaskCache(this)),
+      m_layoutManager(new LayoutManager(this)),
+      m_componentsCache(new QmlComponentsCache(this))
 {
     //! create the window manager
 
-    if (KWindowSystem::isPlatformWayland()) {
+    if (!simulatedWindowSystemScript.isEmpty()) {
+        //! an in-memory window system driven from a script, used for benchmarks and
+        //! regression runs e.g. together with the offscreen platform
+        SimulatedWindowInterface *simulated = new SimulatedWindowInterface(this);
+        simulated->runScript(simulatedWindowSystemScript);
+        m_wm = simulated;
+    } else if (KWindowSystem::isPlatformWayland()) {
         m_wm = new WaylandInterface(this);
     } else {
         m_wm = new XWindowInterface(this);
@@ -115,23 +132,43 @@ Corona::Corona(bool defaultLayoutOnStartup, QString layoutNameOnStartUp, int use
 
     qmlRegisterTypes();
 
+    //! the views qml is compiled in the background while the layouts are loading
+    m_componentsCache->warmUp();
+
     if (m_activityConsumer && (m_activityConsumer->serviceStatus() == KActivities::Consumer::Running)) {
         load();
+    } else {
+        loadSpeculatively();
     }
 
     connect(m_activityConsumer, &KActivities::Consumer::serviceStatusChanged, this, &Corona::load);
 
-    m_viewsScreenSyncTimer.setSingleShot(true);
-    m_viewsScreenSyncTimer.setInterval(m_universalSettings->screenTrackerInterval());
-    connect(&m_viewsScreenSyncTimer, &QTimer::timeout, this, &Corona::syncLatteViewsToScreens);
+    //! the context menu layouts are recalculated only after they changed
+    auto contextMenuLayoutsChanged = [this]() {
+        m_contextMenuLayoutsDirty = true;
+        emit contextMenuDataChanged();
+    };
+
+    connect(m_layoutManager, &LayoutManager::activeLayoutsChanged, this, contextMenuLayoutsChanged);
+    connect(m_layoutManager, &LayoutManager::currentLayoutNameChanged, this, contextMenuLayoutsChanged);
+    connect(m_layoutManager, &LayoutManager::layoutsChanged, this, contextMenuLayoutsChanged);
+    connect(m_layoutManager, &LayoutManager::menuLayoutsChanged, this, contextMenuLayoutsChanged);
+
+    //! screen changes are compressed for screenTrackerInterval in order to give
+    //! the window system the time to settle down before the views are moved
+    m_screenTopology->setInterval(m_universalSettings->screenTrackerInterval());
     connect(m_universalSettings, &UniversalSettings::screenTrackerIntervalChanged, this, [this]() {
-        m_viewsScreenSyncTimer.setInterval(m_universalSettings->screenTrackerInterval());
+        m_screenTopology->setInterval(m_universalSettings->screenTrackerInterval());
     });
 
     //! Dbus adaptor initialization
     new LatteDockAdaptor(this);
     QDBusConnection dbus = QDBusConnection::sessionBus();
     dbus.registerObject(QStringLiteral("/Latte"), this);
+
+    m_statsService = new StatsService(this);
+    new LatteDockStatsAdaptor(m_statsService);
+    dbus.registerObject(QStringLiteral("/Latte/Stats"), m_statsService);
 }
 
 Corona::~Corona()
@@ -154,8 +191,6 @@ Corona::~Corona()
 
     //! END: slide-out views when closing
 
-    m_viewsScreenSyncTimer.stop();
-
     if (m_layoutManager->memoryUsage() == Types::SingleLayout) {
         cleanConfig();
     }
@@ -166,15 +201,22 @@ Corona::~Corona()
 
     m_wm->deleteLater();
     m_globalShortcuts->deleteLater();
+    m_badgesTracker->deleteLater();
     m_layoutManager->deleteLater();
+    m_componentsCache->deleteLater();
     m_screenPool->deleteLater();
+    m_screenTopology->deleteLater();
     m_universalSettings->deleteLater();
     m_plasmaScreenPool->deleteLater();
     m_themeExtended->deleteLater();
+    m_maskCache->deleteLater();
 
     disconnect(m_activityConsumer, &KActivities::Consumer::serviceStatusChanged, this, &Corona::load);
     delete m_activityConsumer;
 
+    //! the trace must contain also the unloading
+    Tracer::self()->stop();
+
     qDebug() << "Latte Corona - deleted...";
 }
 
@@ -182,58 +224,166 @@ void Corona::load()
 {
     if (m_activityConsumer && (m_activityConsumer->serviceStatus() == KActivities::Consumer::Running) && m_activitiesStarting) {
         disconnect(m_activityConsumer, &KActivities::Consumer::serviceStatusChanged, this, &Corona::load);
+
+        if (m_speculativeStartup) {
+            m_activitiesStarting = false;
+            m_speculativeStartup = false;
+
+            //! the views are already present, the activities assignments are validated
+            //! and the layout is switched only if the current activity requires it
+            bool followActivity = !m_defaultLayoutOnStartup && m_layoutNameOnStartUp.isEmpty();
+            m_layoutManager->confirmSpeculativeStartup(followActivity);
+            return;
+        }
+
         m_layoutManager->load();
 
         m_activitiesStarting = false;
 
-        connect(qGuiApp, &QGuiApplication::primaryScreenChanged, this, &Corona::primaryOutputChanged, Qt::UniqueConnection);
-        connect(QApplication::desktop(), &QDesktopWidget::screenCountChanged, this, &Corona::screenCountChanged);
+        startup(startupLayoutName(true));
+    }
+}
 
-        connect(m_screenPool, &ScreenPool::primaryPoolChanged, this, &Corona::screenCountChanged);
+void Corona::loadSpeculatively()
+{
+    //! at login the activities service is often slow to start, in that case the
+    //! last used layout is loaded immediately and the startup is confirmed when
+    //! the service is running. Multiple layouts depend on the running activities
+    //! in order to know which layouts must be loaded, so they are not supported
+    if (!m_activitiesStarting || m_speculativeStartup || startupMemoryUsage() != Types::SingleLayout) {
+        return;
+    }
 
-        QString assignedLayout = m_layoutManager->shouldSwitchToLayout(m_activityConsumer->currentActivity());
+    qDebug() << "Activities service is not running yet, loading layout speculatively...";
 
-        QString loadLayoutName = "";
+    m_speculativeStartup = true;
 
-        if (!m_defaultLayoutOnStartup && m_layoutNameOnStartUp.isEmpty()) {
-            if (!assignedLayout.isEmpty() && assignedLayout != m_universalSettings->currentLayoutName()) {
-                loadLayoutName = assignedLayout;
-            } else {
-                loadLayoutName = m_universalSettings->currentLayoutName();
-            }
+    m_layoutManager->load();
 
-            if (!m_layoutManager->layoutExists(loadLayoutName)) {
-                loadLayoutName = m_layoutManager->defaultLayoutName();
-                m_layoutManager->importDefaultLayout(false);
-            }
-        } else if (m_defaultLayoutOnStartup) {
-            loadLayoutName = m_layoutManager->importer()->uniqueLayoutName(m_layoutManager->defaultLayoutName());
-            m_layoutManager->importDefaultLayout(true);
+    startup(startupLayoutName(false));
+}
+
+QString Corona::startupLayoutName(bool useAssignedLayouts)
+{
+    QString loadLayoutName = "";
+
+    if (!m_defaultLayoutOnStartup && m_layoutNameOnStartUp.isEmpty()) {
+        QString assignedLayout = useAssignedLayouts ? m_layoutManager->shouldSwitchToLayout(m_activityConsumer->currentActivity()) : QString();
+
+        if (!assignedLayout.isEmpty() && assignedLayout != m_universalSettings->currentLayoutName()) {
+            loadLayoutName = assignedLayout;
         } else {
-            loadLayoutName = m_layoutNameOnStartUp;
+            loadLayoutName = m_universalSettings->currentLayoutName();
         }
 
-        if (m_userSetMemoryUsage != -1 && !KWindowSystem::isPlatformWayland()) {
-            Types::LayoutsMemoryUsage usage = static_cast<Types::LayoutsMemoryUsage>(m_userSetMemoryUsage);
+        if (!m_layoutManager->layoutExists(loadLayoutName)) {
+            loadLayoutName = m_layoutManager->defaultLayoutName();
+            m_layoutManager->importDefaultLayout(false);
+        }
+    } else if (m_defaultLayoutOnStartup) {
+        loadLayoutName = m_layoutManager->importer()->uniqueLayoutName(m_layoutManager->defaultLayoutName());
+        m_layoutManager->importDefaultLayout(true);
+    } else {
+        loadLayoutName = m_layoutNameOnStartUp;
+    }
+
+    return loadLayoutName;
+}
+
+Types::LayoutsMemoryUsage Corona::startupMemoryUsage() const
+{
+    if (KWindowSystem::isPlatformWayland()) {
+        return Types::SingleLayout;
+    }
+
+    if (m_userSetMemoryUsage != -1) {
+        return static_cast<Types::LayoutsMemoryUsage>(m_userSetMemoryUsage);
+    }
+
+    return m_universalSettings->layoutsMemoryUsage();
+}
+
+void Corona::startup(QString layoutName)
+{
+    //! the layout is loaded for the current screens, changes that happened
+    //! since the topology was created must not be published afterwards
+    m_screenTopology->resetSnapshot();
+    connect(m_screenTopology, &ScreenTopology::topologyChanged, this, &Corona::screenTopologyChanged, Qt::UniqueConnection);
+
+    if (m_userSetMemoryUsage != -1 && !KWindowSystem::isPlatformWayland()) {
+        Types::LayoutsMemoryUsage usage = static_cast<Types::LayoutsMemoryUsage>(m_userSetMemoryUsage);
+
+        m_universalSettings->setLayoutsMemoryUsage(usage);
+    }
 
-            m_universalSettings->setLayoutsMemoryUsage(usage);
+    if (KWindowSystem::isPlatformWayland()) {
+        m_universalSettings->setLayoutsMemoryUsage(Types::SingleLayout);
+    }
+
+    m_layoutManager->loadLayoutOnStartup(layoutName);
+
+
+    //! load screens signals such screenGeometryChanged in order to support
+    //! plasmoid.screenGeometry properly
+    for (QScreen *screen : qGuiApp->screens()) {
+        addOutput(screen);
+    }
+
+    connect(qGuiApp, &QGuiApplication::screenAdded, this, &Corona::addOutput, Qt::UniqueConnection);
+}
+
+void Corona::startTracing(QString file)
+{
+    Tracer::self()->start(file);
+}
+
+void Corona::stopTracing()
+{
+    Tracer::self()->stop();
+}
+
+void Corona::setFrameStatisticsEnabled(bool enabled)
+{
+    for (const auto &layoutName : m_layoutManager->activeLayoutsNames()) {
+        Layout *layout = m_layoutManager->activeLayout(layoutName);
+
+        if (!layout) {
+            continue;
         }
 
-        if (KWindowSystem::isPlatformWayland()) {
-            m_universalSettings->setLayoutsMemoryUsage(Types::SingleLayout);
+        for (const auto view : *layout->latteViews()) {
+            if (enabled && !view->frameStatistics()->enabled()) {
+                view->frameStatistics()->reset();
+            }
+
+            view->frameStatistics()->setEnabled(enabled);
         }
+    }
+}
 
-        m_layoutManager->loadLayoutOnStartup(loadLayoutName);
+QString Corona::frameStatistics() const
+{
+    QStringList report;
 
+    for (const auto &layoutName : m_layoutManager->activeLayoutsNames()) {
+        Layout *layout = m_layoutManager->activeLayout(layoutName);
 
-        //! load screens signals such screenGeometryChanged in order to support
-        //! plasmoid.screenGeometry properly
-        for (QScreen *screen : qGuiApp->screens()) {
-            addOutput(screen);
+        if (!layout) {
+            continue;
         }
 
-        connect(qGuiApp, &QGuiApplication::screenAdded, this, &Corona::addOutput, Qt::UniqueConnection);
+        for (const auto view : layout->sortedLatteViews()) {
+            report << QStringLiteral("%1, view %2 at %3 %4%5")
+                   .arg(layoutName)
+                   .arg(view->containment() ? view->containment()->id() : 0)
+                   .arg(view->positioner()->currentScreenName())
+                   .arg(view->location())
+                   .arg(view->frameStatistics()->enabled() ? QString() : QStringLiteral(", disabled"));
+            report << view->frameStatistics()->summary();
+        }
     }
+
+    return report.join(QStringLiteral("\n"));
 }
 
 void Corona::unload()
@@ -370,6 +520,11 @@ ScreenPool *Corona::screenPool() const
     return m_screenPool;
 }
 
+ScreenTopology *Corona::screenTopology() const
+{
+    return m_screenTopology;
+}
+
 UniversalSettings *Corona::universalSettings() const
 {
     return m_universalSettings;
@@ -395,6 +550,11 @@ PlasmaExtended::Theme *Corona::themeExtended() const
     return m_themeExtended;
 }
 
+ViewPart::MaskCache *Corona::maskCache() const
+{
+    return m_maskCache;
+}
+
 int Corona::numScreens() const
 {
     return qGuiApp->screens().count();
@@ -652,19 +812,18 @@ void Corona::addOutput(QScreen *screen)
     emit screenAdded(m_screenPool->id(screen->name()));
 }
 
-void Corona::primaryOutputChanged()
-{
-    m_viewsScreenSyncTimer.start();
-}
-
 void Corona::screenRemoved(QScreen *screen)
 {
     Q_ASSERT(screen);
 }
 
-void Corona::screenCountChanged()
+void Corona::screenTopologyChanged(const Latte::ScreenTopologyDiff &diff)
 {
-    m_viewsScreenSyncTimer.start();
+    //! geometry only changes are handled by the views positioners,
+    //! the views need to be redistributed only when outputs changed
+    if (diff.outputsChanged()) {
+        syncLatteViewsToScreens();
+    }
 }
 
 //! the central functions that updates loading/unloading latteviews
@@ -939,7 +1098,12 @@ void Corona::windowColorScheme(QString windowIdAndScheme)
 //! update badge for specific view item
 void Corona::updateDockItemBadge(QString identifier, QString value)
 {
-    m_globalShortcuts->updateViewItemBadge(identifier, value);
+    m_badgesTracker->updateBadge(identifier, value);
+}
+
+void Corona::updateDockItemBadges(const QVariantMap &badges)
+{
+    m_badgesTracker->updateBadges(badges);
 }
 
 
@@ -966,6 +1130,15 @@ void Corona::setContextMenuView(int id)
 }
 
 QStringList Corona::contextMenuData()
+{
+    QStringList data = viewContextMenuData(m_contextMenuViewId);
+
+    //! reset context menu view id
+    m_contextMenuViewId = -1;
+    return data;
+}
+
+QStringList Corona::viewContextMenuData(int id)
 {
     QStringList data;
     Types::ViewType viewType{Types::DockView};
@@ -973,24 +1146,34 @@ QStringList Corona::contextMenuData()
     Layout *currentLayout = m_layoutManager->currentLayout();
 
     if (currentLayout) {
-        viewType = currentLayout->latteViewType(m_contextMenuViewId);
+        viewType = currentLayout->latteViewType(id);
+    }
+
+    if (m_contextMenuLayoutsDirty) {
+        updateContextMenuLayouts();
     }
 
     data << QString::number((int)m_layoutManager->memoryUsage());
     data << m_layoutManager->currentLayoutName();
     data << QString::number((int)viewType);
+    data << m_contextMenuLayouts;
+
+    return data;
+}
+
+void Corona::updateContextMenuLayouts()
+{
+    m_contextMenuLayouts.clear();
 
     foreach (auto layoutName, m_layoutManager->menuLayouts()) {
         if (m_layoutManager->activeLayout(layoutName)) {
-            data << QString("1," + layoutName);
+            m_contextMenuLayouts << QString("1," + layoutName);
         } else {
-            data << QString("0," + layoutName);
+            m_contextMenuLayouts << QString("0," + layoutName);
         }
     }
 
-    //! reset context menu view id
-    m_contextMenuViewId = -1;
-    return data;
+    m_contextMenuLayoutsDirty = false;
 }
 
 inline void Corona::qmlRegisterTypes() const
@@ -28,6 +28,7 @@
 // Qt
 #include <QObject>
 #include <QTimer>
+#include <QVariantMap>
 
 // Plasma
 #include <Plasma/Corona>
@@ -61,11 +62,18 @@ class PlasmaShell;
 
 namespace Latte {
 class AbstractWindowInterface;
+class BadgesTracker;
 class ScreenPool;
+class ScreenTopology;
 class GlobalShortcuts;
 class UniversalSettings;
 class LayoutManager;
 class LaunchersSignals;
+class QmlComponentsCache;
+class StatsService;
+namespace ViewPart {
+class MaskCache;
+}
 namespace PlasmaExtended{
 class ScreenPool;
 class Theme;
@@ -73,6 +81,7 @@ class Theme;
 }
 
 namespace Latte {
+struct ScreenTopologyDiff;
 
 class Corona : public Plasma::Corona
 {
@@ -83,6 +92,7 @@ public:
     Corona(bool defaultLayoutOnStartup = false,
                QString layoutNameOnStartUp = QString(),
                int userSetMemoryUsage = -1,
+               QString simulatedWindowSystemScript = QString(),
                QObject *parent = nullptr);
     virtual ~Corona();
 
@@ -108,19 +118,25 @@ public:
     KActivities::Consumer *activitiesConsumer() const;
     GlobalShortcuts *globalShortcuts() const;
     ScreenPool *screenPool() const;
+    ScreenTopology *screenTopology() const;
     UniversalSettings *universalSettings() const;
     LayoutManager *layoutManager() const;
 
     PlasmaExtended::ScreenPool *plasmaScreenPool() const;
     PlasmaExtended::Theme *themeExtended() const;
 
+    ViewPart::MaskCache *maskCache() const;
+
     KWayland::Client::PlasmaShell *waylandCoronaInterface() const;
 
-    //! these functions are used from context menu through containmentactions
-    void switchToLayout(QString layout);
-    void showSettingsWindow(int page);
-    void setContextMenuView(int id);
-    QStringList contextMenuData();
+    //! these functions are used from context menu through containmentactions,
+    //! when the containment action is loaded inside Latte they are called directly
+    //! otherwise through dbus
+    Q_INVOKABLE void switchToLayout(QString layout);
+    Q_INVOKABLE void showSettingsWindow(int page);
+    Q_INVOKABLE void setContextMenuView(int id);
+    Q_INVOKABLE QStringList contextMenuData();
+    Q_INVOKABLE QStringList viewContextMenuData(int id);
 
 public slots:
     void aboutApplication();
@@ -129,12 +145,25 @@ public slots:
     void windowColorScheme(QString windowIdAndScheme);
     void loadDefaultLayout() override;
     void updateDockItemBadge(QString identifier, QString value);
+    //! identifier -> value pairs, they are applied together with the pending single updates
+    void updateDockItemBadges(const QVariantMap &badges);
     void unload();
 
+    //! record a performance trace in the Chrome trace event format,
+    //! the file is written when the tracing stops
+    void startTracing(QString file);
+    void stopTracing();
+
+    //! frame timings of the views animations, see ViewPart::FrameStatistics
+    void setFrameStatisticsEnabled(bool enabled);
+    QString frameStatistics() const;
+
 signals:
     void configurationShown(PlasmaQuick::ConfigView *configView);
     void viewLocationChanged();
     void raiseViewsTemporaryChanged();
+    //! the layouts or the view types that are shown in the context menu changed
+    void contextMenuDataChanged();
 
 private slots:
     void alternativesVisibilityChanged(bool visible);
@@ -142,13 +171,15 @@ private slots:
     void load();
 
     void addOutput(QScreen *screen);
-    void primaryOutputChanged();
     void screenRemoved(QScreen *screen);
-    void screenCountChanged();
+    void screenTopologyChanged(const Latte::ScreenTopologyDiff &diff);
     void syncLatteViewsToScreens();
 
 private:
     void cleanConfig();
+    void loadSpeculatively();
+    void startup(QString layoutName);
+    void updateContextMenuLayouts();
     void qmlRegisterTypes() const;
     void setupWaylandIntegration();
 
@@ -157,12 +188,20 @@ private:
 
     int primaryScreenId() const;
 
+    //! the layout that must be loaded on startup, when useAssignedLayouts is false
+    //! the activities assignments are ignored
+    QString startupLayoutName(bool useAssignedLayouts);
+    Types::LayoutsMemoryUsage startupMemoryUsage() const;
+
     QStringList containmentsIds();
     QStringList appletsIds();
 
     bool m_activitiesStarting{true};
+    //! the views were loaded before the activities service was running
+    bool m_speculativeStartup{false};
     bool m_defaultLayoutOnStartup{false}; //! this is used to enforce loading the default layout on startup
     bool m_quitTimedEnded{false}; //! this is used on destructor in order to delay it and slide-out the views
+    bool m_contextMenuLayoutsDirty{true};
 
     //!it can be used on startup to change memory usage from command line
     int m_userSetMemoryUsage{ -1};
@@ -171,22 +210,29 @@ private:
 
     QString m_layoutNameOnStartUp;
 
-    QList<KDeclarative::QmlObject *> m_alternativesObjects;
+    //! precomputed layouts part of the context menu data
+    QStringList m_contextMenuLayouts;
 
-    QTimer m_viewsScreenSyncTimer;
+    QList<KDeclarative::QmlObject *> m_alternativesObjects;
 
     KActivities::Consumer *m_activityConsumer;
     QPointer<KAboutApplicationDialog> aboutDialog;
 
     AbstractWindowInterface *m_wm{nullptr};
     ScreenPool *m_screenPool{nullptr};
+    ScreenTopology *m_screenTopology{nullptr};
     UniversalSettings *m_universalSettings{nullptr};
     GlobalShortcuts *m_globalShortcuts{nullptr};
+    BadgesTracker *m_badgesTracker{nullptr};
     LayoutManager *m_layoutManager{nullptr};
+    QmlComponentsCache *m_componentsCache{nullptr};
+    StatsService *m_statsService{nullptr};
 
     PlasmaExtended::ScreenPool *m_plasmaScreenPool{nullptr};
     PlasmaExtended::Theme *m_themeExtended{nullptr};
 
+    ViewPart::MaskCache *m_maskCache{nullptr};
+
     KWayland::Client::PlasmaShell *m_waylandCorona{nullptr};
 
     friend class GlobalShortcuts;
@@ -21,16 +21,14 @@
 #include "launcherssignals.h"
 
 // local
-#include "lattecorona.h"
+#include "appletendpoints.h"
 #include "layoutmanager.h"
-#include "layout/layout.h"
 
 // Qt
-#include <QQuickItem>
+#include <QAbstractProxyModel>
 
 // Plasma
 #include <Plasma/Applet>
-#include <Plasma/Containment>
 
 namespace Latte {
 
@@ -44,30 +42,36 @@ LaunchersSignals::~LaunchersSignals()
 {
 }
 
-QList<Plasma::Applet *> LaunchersSignals::lattePlasmoids(QString layoutName)
+QList<TasksEndpoint> LaunchersSignals::lattePlasmoids(QString layoutName)
 {
-    QList<Plasma::Applet *> applets;
-
-    Layout *layout = m_manager->activeLayout(layoutName);
-    QList<Plasma::Containment *> containments;
+    return m_manager->appletEndpoints()->tasksEndpoints(layoutName);
+}
 
-    if (layoutName.isEmpty()) {
-        containments = m_manager->corona()->containments();
-    } else if (layout) {
-        containments = *(layout->containments());
+bool LaunchersSignals::sharesTasksModelWithSender(const TasksEndpoint &endpoint, const QList<TasksEndpoint> &endpoints, int senderId) const
+{
+    if (!endpoint.item || !endpoint.tasksModel.isValid()) {
+        return false;
     }
 
-    foreach (auto containment, containments) {
-        for (auto *applet : containment->applets()) {
-            KPluginMetaData meta = applet->kPackage().metadata();
+    for (const auto &senderEndpoint : endpoints) {
+        if (senderEndpoint.item && senderEndpoint.applet && senderEndpoint.applet->id() == (uint)senderId
+            && senderEndpoint.tasksModel.isValid()) {
+            QObject *senderModel = sourceTasksModel(senderEndpoint);
 
-            if (meta.pluginId() == "org.kde.latte.plasmoid") {
-                applets.append(applet);
-            }
+            return senderModel && senderModel == sourceTasksModel(endpoint);
         }
     }
 
-    return applets;
+    return false;
+}
+
+QObject *LaunchersSignals::sourceTasksModel(const TasksEndpoint &endpoint) const
+{
+    QObject *model = endpoint.tasksModel.read(endpoint.item).value<QObject *>();
+    auto proxyModel = qobject_cast<QAbstractProxyModel *>(model);
+
+    //! each plasmoid filters the shared model through a proxy of its own
+    return proxyModel ? proxyModel->sourceModel() : model;
 }
 
 void LaunchersSignals::addLauncher(QString layoutName, int launcherGroup, QString launcher)
@@ -80,27 +84,8 @@ void LaunchersSignals::addLauncher(QString layoutName, int launcherGroup, QStrin
 
     QString lName = (group == Types::LayoutLaunchers) ? layoutName : "";
 
-    foreach (auto applet, lattePlasmoids(lName)) {
-        if (QQuickItem *appletInterface = applet->property("_plasma_graphicObject").value<QQuickItem *>()) {
-            const auto &childItems = appletInterface->childItems();
-
-            if (childItems.isEmpty()) {
-                continue;
-            }
-
-            for (QQuickItem *item : childItems) {
-                if (auto *metaObject = item->metaObject()) {
-                    int methodIndex = metaObject->indexOfMethod("extSignalAddLauncher(QVariant,QVariant)");
-
-                    if (methodIndex == -1) {
-                        continue;
-                    }
-
-                    QMetaMethod method = metaObject->method(methodIndex);
-                    method.invoke(item, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launcher));
-                }
-            }
-        }
+    for (const auto &endpoint : lattePlasmoids(lName)) {
+        endpoint.addLauncher.invoke(endpoint.item, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launcher));
     }
 }
 
@@ -114,27 +99,8 @@ void LaunchersSignals::removeLauncher(QString layoutName, int launcherGroup, QSt
 
     QString lName = (group == Types::LayoutLaunchers) ? layoutName : "";
 
-    foreach (auto applet, lattePlasmoids(lName)) {
-        if (QQuickItem *appletInterface = applet->property("_plasma_graphicObject").value<QQuickItem *>()) {
-            const auto &childItems = appletInterface->childItems();
-
-            if (childItems.isEmpty()) {
-                continue;
-            }
-
-            for (QQuickItem *item : childItems) {
-                if (auto *metaObject = item->metaObject()) {
-                    int methodIndex = metaObject->indexOfMethod("extSignalRemoveLauncher(QVariant,QVariant)");
-
-                    if (methodIndex == -1) {
-                        continue;
-                    }
-
-                    QMetaMethod method = metaObject->method(methodIndex);
-                    method.invoke(item, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launcher));
-                }
-            }
-        }
+    for (const auto &endpoint : lattePlasmoids(lName)) {
+        endpoint.removeLauncher.invoke(endpoint.item, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launcher));
     }
 }
 
@@ -148,27 +114,8 @@ void LaunchersSignals::addLauncherToActivity(QString layoutName, int launcherGro
 
     QString lName = (group == Types::LayoutLaunchers) ? layoutName : "";
 
-    foreach (auto applet, lattePlasmoids(lName)) {
-        if (QQuickItem *appletInterface = applet->property("_plasma_graphicObject").value<QQuickItem *>()) {
-            const auto &childItems = appletInterface->childItems();
-
-            if (childItems.isEmpty()) {
-                continue;
-            }
-
-            for (QQuickItem *item : childItems) {
-                if (auto *metaObject = item->metaObject()) {
-                    int methodIndex = metaObject->indexOfMethod("extSignalAddLauncherToActivity(QVariant,QVariant,QVariant)");
-
-                    if (methodIndex == -1) {
-                        continue;
-                    }
-
-                    QMetaMethod method = metaObject->method(methodIndex);
-                    method.invoke(item, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launcher), Q_ARG(QVariant, activity));
-                }
-            }
-        }
+    for (const auto &endpoint : lattePlasmoids(lName)) {
+        endpoint.addLauncherToActivity.invoke(endpoint.item, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launcher), Q_ARG(QVariant, activity));
     }
 }
 
@@ -182,27 +129,8 @@ void LaunchersSignals::removeLauncherFromActivity(QString layoutName, int launch
 
     QString lName = (group == Types::LayoutLaunchers) ? layoutName : "";
 
-    foreach (auto applet, lattePlasmoids(lName)) {
-        if (QQuickItem *appletInterface = applet->property("_plasma_graphicObject").value<QQuickItem *>()) {
-            const auto &childItems = appletInterface->childItems();
-
-            if (childItems.isEmpty()) {
-                continue;
-            }
-
-            for (QQuickItem *item : childItems) {
-                if (auto *metaObject = item->metaObject()) {
-                    int methodIndex = metaObject->indexOfMethod("extSignalRemoveLauncherFromActivity(QVariant,QVariant,QVariant)");
-
-                    if (methodIndex == -1) {
-                        continue;
-                    }
-
-                    QMetaMethod method = metaObject->method(methodIndex);
-                    method.invoke(item, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launcher), Q_ARG(QVariant, activity));
-                }
-            }
-        }
+    for (const auto &endpoint : lattePlasmoids(lName)) {
+        endpoint.removeLauncherFromActivity.invoke(endpoint.item, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launcher), Q_ARG(QVariant, activity));
     }
 }
 
@@ -216,27 +144,8 @@ void LaunchersSignals::urlsDropped(QString layoutName, int launcherGroup, QStrin
 
     QString lName = (group == Types::LayoutLaunchers) ? layoutName : "";
 
-    foreach (auto applet, lattePlasmoids(lName)) {
-        if (QQuickItem *appletInterface = applet->property("_plasma_graphicObject").value<QQuickItem *>()) {
-            const auto &childItems = appletInterface->childItems();
-
-            if (childItems.isEmpty()) {
-                continue;
-            }
-
-            for (QQuickItem *item : childItems) {
-                if (auto *metaObject = item->metaObject()) {
-                    int methodIndex = metaObject->indexOfMethod("extSignalUrlsDropped(QVariant,QVariant)");
-
-                    if (methodIndex == -1) {
-                        continue;
-                    }
-
-                    QMetaMethod method = metaObject->method(methodIndex);
-                    method.invoke(item, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, urls));
-                }
-            }
-        }
+    for (const auto &endpoint : lattePlasmoids(lName)) {
+        endpoint.urlsDropped.invoke(endpoint.item, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, urls));
     }
 }
 
@@ -250,28 +159,11 @@ void LaunchersSignals::moveTask(QString layoutName, int senderId, int launcherGr
 
     QString lName = (group == Types::LayoutLaunchers) ? layoutName : "";
 
-    foreach (auto applet, lattePlasmoids(lName)) {
-        if (applet->id() != senderId) {
-            if (QQuickItem *appletInterface = applet->property("_plasma_graphicObject").value<QQuickItem *>()) {
-                const auto &childItems = appletInterface->childItems();
-
-                if (childItems.isEmpty()) {
-                    continue;
-                }
-
-                for (QQuickItem *item : childItems) {
-                    if (auto *metaObject = item->metaObject()) {
-                        int methodIndex = metaObject->indexOfMethod("extSignalMoveTask(QVariant,QVariant,QVariant)");
+    const QList<TasksEndpoint> endpoints = lattePlasmoids(lName);
 
-                        if (methodIndex == -1) {
-                            continue;
-                        }
-
-                        QMetaMethod method = metaObject->method(methodIndex);
-                        method.invoke(item, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, from), Q_ARG(QVariant, to));
-                    }
-                }
-            }
+    for (const auto &endpoint : endpoints) {
+        if (endpoint.applet->id() != senderId && !sharesTasksModelWithSender(endpoint, endpoints, senderId)) {
+            endpoint.moveTask.invoke(endpoint.item, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, from), Q_ARG(QVariant, to));
         }
     }
 }
@@ -286,28 +178,11 @@ void LaunchersSignals::validateLaunchersOrder(QString layoutName, int senderId,
 
     QString lName = (group == Types::LayoutLaunchers) ? layoutName : "";
 
-    foreach (auto applet, lattePlasmoids(lName)) {
-        if (applet->id() != senderId) {
-            if (QQuickItem *appletInterface = applet->property("_plasma_graphicObject").value<QQuickItem *>()) {
-                const auto &childItems = appletInterface->childItems();
-
-                if (childItems.isEmpty()) {
-                    continue;
-                }
-
-                for (QQuickItem *item : childItems) {
-                    if (auto *metaObject = item->metaObject()) {
-                        int methodIndex = metaObject->indexOfMethod("extSignalValidateLaunchersOrder(QVariant,QVariant)");
-
-                        if (methodIndex == -1) {
-                            continue;
-                        }
+    const QList<TasksEndpoint> endpoints = lattePlasmoids(lName);
 
-                        QMetaMethod method = metaObject->method(methodIndex);
-                        method.invoke(item, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launchers));
-                    }
-                }
-            }
+    for (const auto &endpoint : endpoints) {
+        if (endpoint.applet->id() != senderId && !sharesTasksModelWithSender(endpoint, endpoints, senderId)) {
+            endpoint.validateLaunchersOrder.invoke(endpoint.item, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launchers));
         }
     }
 }
@@ -27,12 +27,9 @@
 // Qt
 #include <QObject>
 
-namespace Plasma {
-class Applet;
-}
-
 namespace Latte {
 class LayoutManager;
+struct TasksEndpoint;
 }
 
 namespace Latte {
@@ -62,7 +59,13 @@ public slots:
     Q_INVOKABLE void validateLaunchersOrder(QString layoutName, int senderId, int launcherGroup, QStringList launchers);
 
 private:
-    QList<Plasma::Applet *> lattePlasmoids(QString layoutName);
+    QList<TasksEndpoint> lattePlasmoids(QString layoutName);
+
+    //! the plasmoids that share their tasks model with the sender have
+    //! already been updated through the model itself
+    bool sharesTasksModelWithSender(const TasksEndpoint &endpoint, const QList<TasksEndpoint> &endpoints, int senderId) const;
+
+    QObject *sourceTasksModel(const TasksEndpoint &endpoint) const;
 
 private:
     LayoutManager *m_manager{nullptr};
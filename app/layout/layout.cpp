@@ -31,6 +31,7 @@
 #include "../shortcuts/shortcutstracker.h"
 #include "../view/positioner.h"
 #include "../view/view.h"
+#include "../../liblatte2/tracer.h"
 
 // Qt
 #include <QDir>
@@ -51,8 +52,11 @@ namespace Latte {
 const QString Layout::MultipleLayoutsName = ".multiple-layouts_hidden";
 
 Layout::Layout(QObject *parent, QString layoutFile, QString assignedName)
-    : QObject(parent)
+    : QObject(parent),
+      m_launchersStore(new LaunchersStore(this))
 {
+    connect(m_launchersStore, &LaunchersStore::launchersChanged, this, &Layout::launchersChanged);
+
     qDebug() << "Layout file to create object: " << layoutFile << " with name: " << assignedName;
 
     if (QFile(layoutFile).exists()) {
@@ -85,6 +89,11 @@ void Layout::syncToLayoutFile(bool removeLayoutId)
         return;
     }
 
+    //! the views settings that are still pending must be part of the file
+    foreach (auto view, m_latteViews) {
+        view->configStore()->flush();
+    }
+
     KSharedConfigPtr filePtr = KSharedConfig::openConfig(m_layoutFile);
 
     KConfigGroup oldContainments = KConfigGroup(filePtr, "Containments");
@@ -112,6 +121,9 @@ void Layout::syncToLayoutFile(bool removeLayoutId)
 
 void Layout::unloadContainments()
 {
+    //! launchers changes that are still pending are saved while the layout is complete
+    m_launchersStore->flush();
+
     if (!m_corona) {
         return;
     }
@@ -182,7 +194,8 @@ void Layout::init()
     connect(this, &Layout::disableBordersForMaximizedWindowsChanged, this, &Layout::saveConfig);
     connect(this, &Layout::showInMenuChanged, this, &Layout::saveConfig);
     connect(this, &Layout::textColorChanged, this, &Layout::saveConfig);
-    connect(this, &Layout::launchersChanged, this, &Layout::saveConfig);
+    //! launchers are changing in bursts, e.g. when they are dragged around
+    connect(m_launchersStore, &LaunchersStore::persistRequested, this, &Layout::saveConfig);
     connect(this, &Layout::lastUsedActivityChanged, this, &Layout::saveConfig);
     connect(this, &Layout::preferredForShortcutsTouchedChanged, this, &Layout::saveConfig);
 }
@@ -522,17 +535,17 @@ void Layout::setFile(QString file)
 
 QStringList Layout::launchers() const
 {
-    return m_launchers;
+    return m_launchersStore->launchers();
 }
 
 void Layout::setLaunchers(QStringList launcherList)
 {
-    if (m_launchers == launcherList)
-        return;
-
-    m_launchers = launcherList;
+    m_launchersStore->setLaunchers(launcherList);
+}
 
-    emit launchersChanged();
+LaunchersStore *Layout::launchersStore() const
+{
+    return m_launchersStore;
 }
 
 QStringList Layout::activities() const
@@ -744,7 +757,7 @@ void Layout::loadConfig()
     m_showInMenu = m_layoutGroup.readEntry("showInMenu", false);
     m_textColor = m_layoutGroup.readEntry("textColor", QString("fcfcfc"));
     m_activities = m_layoutGroup.readEntry("activities", QStringList());
-    m_launchers = m_layoutGroup.readEntry("launchers", QStringList());
+    m_launchersStore->loadLaunchers(m_layoutGroup.readEntry("launchers", QStringList()));
     m_lastUsedActivity = m_layoutGroup.readEntry("lastUsedActivity", QString());
     m_preferredForShortcutsTouched = m_layoutGroup.readEntry("preferredForShortcutsTouched", false);
 
@@ -768,7 +781,7 @@ void Layout::saveConfig()
     m_layoutGroup.writeEntry("showInMenu", m_showInMenu);
     m_layoutGroup.writeEntry("color", m_color);
     m_layoutGroup.writeEntry("disableBordersForMaximizedWindows", m_disableBordersForMaximizedWindows);
-    m_layoutGroup.writeEntry("launchers", m_launchers);
+    m_layoutGroup.writeEntry("launchers", m_launchersStore->launchers());
     m_layoutGroup.writeEntry("background", m_background);
     m_layoutGroup.writeEntry("activities", m_activities);
     m_layoutGroup.writeEntry("lastUsedActivity", m_lastUsedActivity);
@@ -1027,6 +1040,11 @@ void Layout::updateLastUsedActivity()
         return;
     }
 
+    //! the last used activity is kept until the activities service is running
+    if (m_corona->activitiesConsumer()->serviceStatus() != KActivities::Consumer::Running) {
+        return;
+    }
+
     if (!m_lastUsedActivity.isEmpty() && !m_corona->layoutManager()->activities().contains(m_lastUsedActivity)) {
         clearLastUsedActivity();
     }
@@ -1100,6 +1118,8 @@ void Layout::containmentDestroyed(QObject *cont)
 
 void Layout::addView(Plasma::Containment *containment, bool forceOnPrimary, int explicitScreen)
 {
+    LATTE_TRACE_SCOPE("layouts", "Layout::addView");
+
     qDebug() << "Layout :::: " << m_layoutName << " ::: addView was called... m_containments :: " << m_containments.size();
 
     if (!containment || !m_corona || !containment->kPackage().isValid()) {
@@ -1176,7 +1196,7 @@ void Layout::addView(Plasma::Containment *containment, bool forceOnPrimary, int
                 testScreenId = testContainment->lastScreen();
             }
 
-            bool testOnPrimary = testContainment->config().readEntry("onPrimary", true);
+            bool testOnPrimary = view->onPrimary();
             Plasma::Types::Location testLocation = static_cast<Plasma::Types::Location>((int)testContainment->config().readEntry("location", (int)Plasma::Types::BottomEdge));
 
             if (!testOnPrimary && m_corona->screenPool()->primaryScreenId() == testScreenId && testLocation == containment->location()) {
@@ -1229,6 +1249,7 @@ void Layout::addView(Plasma::Containment *containment, bool forceOnPrimary, int
     //  connect(containment, &QObject::destroyed, this, &Layout::containmentDestroyed);
     connect(containment, &Plasma::Applet::destroyedChanged, this, &Layout::destroyedChanged);
     connect(containment, &Plasma::Applet::locationChanged, m_corona, &Latte::Corona::viewLocationChanged);
+    connect(latteView, &Latte::View::typeChanged, m_corona, &Latte::Corona::contextMenuDataChanged);
     connect(containment, &Plasma::Containment::appletAlternativesRequested
             , m_corona, &Latte::Corona::showAlternativesForApplet, Qt::QueuedConnection);
 
@@ -1263,6 +1284,11 @@ void Layout::copyView(Plasma::Containment *containment)
         return;
 
     qDebug() << "copying containment layout";
+
+    if (m_latteViews.contains(containment)) {
+        m_latteViews[containment]->configStore()->flush();
+    }
+
     //! Setting mutable for create a containment
     m_corona->setImmutability(Plasma::Types::Mutable);
 
@@ -1751,19 +1777,17 @@ void Layout::syncLatteViewsToScreens()
     QList<uint> futureShownViews;
     QString prmScreenName = qGuiApp->primaryScreen()->name();
 
+    QList<Plasma::Containment *> explicitContainments;
+
     //! first step: primary docks must be placed in primary screen free edges
     foreach (auto containment, m_containments) {
         if (isLatteContainment(containment)) {
-            int screenId = containment->screen();
-
-            if (screenId == -1) {
-                screenId = containment->lastScreen();
-            }
-
-            bool onPrimary = containment->config().readEntry("onPrimary", true);
-            Plasma::Types::Location location = static_cast<Plasma::Types::Location>((int)containment->config().readEntry("location", (int)Plasma::Types::BottomEdge));
+            bool onPrimary = containmentOnPrimary(containment);
+            Plasma::Types::Location location = containment->location();
 
-            if (onPrimary && !futureDocksLocations[prmScreenName].contains(location)) {
+            if (!onPrimary) {
+                explicitContainments << containment;
+            } else if (!futureDocksLocations[prmScreenName].contains(location)) {
                 futureDocksLocations[prmScreenName].append(location);
                 futureShownViews.append(containment->id());
             }
@@ -1771,25 +1795,19 @@ void Layout::syncLatteViewsToScreens()
     }
 
     //! second step: explicit docks must be placed in their screens if the screen edge is free
-    foreach (auto containment, m_containments) {
-        if (isLatteContainment(containment)) {
-            int screenId = containment->screen();
-
-            if (screenId == -1) {
-                screenId = containment->lastScreen();
-            }
+    foreach (auto containment, explicitContainments) {
+        int screenId = containment->screen();
 
-            bool onPrimary = containment->config().readEntry("onPrimary", true);
-            Plasma::Types::Location location = static_cast<Plasma::Types::Location>((int)containment->config().readEntry("location", (int)Plasma::Types::BottomEdge));
+        if (screenId == -1) {
+            screenId = containment->lastScreen();
+        }
 
-            if (!onPrimary) {
-                QString expScreenName = m_corona->screenPool()->connector(screenId);
+        Plasma::Types::Location location = containment->location();
+        QString expScreenName = m_corona->screenPool()->connector(screenId);
 
-                if (m_corona->screenPool()->screenExists(screenId) && !futureDocksLocations[expScreenName].contains(location)) {
-                    futureDocksLocations[expScreenName].append(location);
-                    futureShownViews.append(containment->id());
-                }
-            }
+        if (m_corona->screenPool()->screenExists(screenId) && !futureDocksLocations[expScreenName].contains(location)) {
+            futureDocksLocations[expScreenName].append(location);
+            futureShownViews.append(containment->id());
         }
     }
 
@@ -1995,7 +2013,7 @@ bool Layout::explicitDockOccupyEdge(int screen, Plasma::Types::Location location
 
     foreach (auto containment, m_containments) {
         if (isLatteContainment(containment)) {
-            bool onPrimary = containment->config().readEntry("onPrimary", true);
+            bool onPrimary = containmentOnPrimary(containment);
             int id = containment->lastScreen();
             Plasma::Types::Location contLocation = containment->location();
 
@@ -2016,7 +2034,7 @@ bool Layout::primaryDockOccupyEdge(Plasma::Types::Location location) const
 
     foreach (auto containment, m_containments) {
         if (isLatteContainment(containment)) {
-            bool onPrimary = containment->config().readEntry("onPrimary", true);
+            bool onPrimary = containmentOnPrimary(containment);
             Plasma::Types::Location contLocation = containment->location();
 
             if (onPrimary && contLocation == location) {
@@ -2028,6 +2046,13 @@ bool Layout::primaryDockOccupyEdge(Plasma::Types::Location location) const
     return false;
 }
 
+bool Layout::containmentOnPrimary(Plasma::Containment *containment) const
+{
+    Latte::View *view = m_latteViews.value(containment);
+
+    return view ? view->onPrimary() : containment->config().readEntry("onPrimary", true);
+}
+
 bool Layout::isLatteContainment(Plasma::Containment *containment) const
 {
     if (!containment) {
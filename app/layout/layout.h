@@ -22,6 +22,7 @@
 #define LAYOUT_H
 
 // local
+#include "../../liblatte2/launchersstore.h"
 #include "../../liblatte2/types.h"
 
 // Qt
@@ -44,6 +45,7 @@ class Types;
 
 namespace Latte {
 class Corona;
+class CoronaBenchmarks;
 class View;
 namespace LayoutPart {
 class Shortcuts;
@@ -70,6 +72,8 @@ class Layout : public QObject
     Q_PROPERTY(QStringList launchers READ launchers WRITE setLaunchers NOTIFY launchersChanged)
     Q_PROPERTY(QStringList activities READ activities WRITE setActivities NOTIFY activitiesChanged)
 
+    Q_PROPERTY(Latte::LaunchersStore *launchersStore READ launchersStore CONSTANT)
+
     Q_PROPERTY(bool preferredForShortcutsTouched READ preferredForShortcutsTouched WRITE setPreferredForShortcutsTouched NOTIFY preferredForShortcutsTouchedChanged)
 
 public:
@@ -124,6 +128,9 @@ public:
     QStringList launchers() const;
     void setLaunchers(QStringList launcherList);
 
+    //! the layout launchers, shared by all the plasmoids that use them
+    LaunchersStore *launchersStore() const;
+
     static QString layoutName(const QString &fileName);
 
     void renameLayout(QString newName);
@@ -232,6 +239,10 @@ private:
     bool explicitDockOccupyEdge(int screen, Plasma::Types::Location location) const;
     bool primaryDockOccupyEdge(Plasma::Types::Location location) const;
 
+    //! running views may not have written their onPrimary setting yet,
+    //! the config is read only for containments without a view
+    bool containmentOnPrimary(Plasma::Containment *containment) const;
+
     //! Check if a containment is a latte dock/panel
     bool isLatteContainment(Plasma::Containment *containment) const;
     //! Check if an applet config group is valid or belongs to removed applet
@@ -262,7 +273,6 @@ private:
     QString m_layoutName;
     QString m_textColor;
     QStringList m_activities;
-    QStringList m_launchers;
     bool m_preferredForShortcutsTouched{false};
 
     QStringList m_unloadedContainmentsIds;
@@ -270,12 +280,16 @@ private:
     Latte::Corona *m_corona{nullptr};
     QPointer<Latte::LayoutPart::Shortcuts> m_shortcuts;
 
+    LaunchersStore *m_launchersStore{nullptr};
+
     KConfigGroup m_layoutGroup;
 
     QList<Plasma::Containment *> m_containments;
 
     QHash<const Plasma::Containment *, Latte::View *> m_latteViews;
     QHash<const Plasma::Containment *, Latte::View *> m_waitingLatteViews;
+
+    friend class Latte::CoronaBenchmarks;
 };
 
 }
@@ -29,6 +29,7 @@
 #include "settings/settingsdialog.h"
 #include "settings/universalsettings.h"
 #include "view/view.h"
+#include "../liblatte2/tracer.h"
 
 // Qt
 #include <QDir>
@@ -49,6 +50,7 @@ const int MultipleLayoutsPresetId = 10;
 
 LayoutManager::LayoutManager(QObject *parent)
     : QObject(parent),
+      m_appletEndpoints(new AppletEndpoints(this)),
       m_importer(new Importer(this)),
       m_launchersSignals(new LaunchersSignals(this)),
       m_activitiesController(new KActivities::Controller(this))
@@ -69,6 +71,7 @@ LayoutManager::~LayoutManager()
 {
     m_importer->deleteLater();
     m_launchersSignals->deleteLater();
+    m_appletEndpoints->deleteLater();
 
     while (!m_activeLayouts.isEmpty()) {
         Layout *layout = m_activeLayouts.at(0);
@@ -111,8 +114,20 @@ void LayoutManager::load()
 
     qDebug() << "Latte is loading  its layouts...";
 
+    //! during a speculative startup the activities service is not running yet, its first
+    //! current activity must not switch away from the loaded layout, the activities are
+    //! followed only after the startup has been confirmed
+    if (!m_corona->m_speculativeStartup) {
+        connectActivitiesSignals();
+    }
+
+    loadLayouts();
+}
+
+void LayoutManager::connectActivitiesSignals()
+{
     connect(m_corona->m_activityConsumer, &KActivities::Consumer::currentActivityChanged,
-            this, &LayoutManager::currentActivityChanged);
+            this, &LayoutManager::currentActivityChanged, Qt::UniqueConnection);
 
     connect(m_corona->m_activityConsumer, &KActivities::Consumer::runningActivitiesChanged,
     this, [&]() {
@@ -120,8 +135,6 @@ void LayoutManager::load()
             syncMultipleLayoutsToActivities();
         }
     });
-
-    loadLayouts();
 }
 
 void LayoutManager::unload()
@@ -174,6 +187,11 @@ Importer *LayoutManager::importer()
     return m_importer;
 }
 
+AppletEndpoints *LayoutManager::appletEndpoints()
+{
+    return m_appletEndpoints;
+}
+
 LaunchersSignals *LayoutManager::launchersSignals()
 {
     return m_launchersSignals;
@@ -513,6 +531,8 @@ void LayoutManager::loadLayouts()
 
 void LayoutManager::loadLayoutOnStartup(QString layoutName)
 {
+    LATTE_TRACE_SCOPE("layouts", "LayoutManager::loadLayoutOnStartup");
+
     // if (memoryUsage() == Types::MultipleLayouts) {
     QStringList layouts = m_importer->checkRepairMultipleLayoutsLinkedFile();
 
@@ -533,6 +553,24 @@ void LayoutManager::loadLayoutOnStartup(QString layoutName)
     switchToLayout(layoutName);
 }
 
+void LayoutManager::confirmSpeculativeStartup(bool followActivity)
+{
+    //! the layouts activities can be validated only now
+    loadLayouts();
+    connectActivitiesSignals();
+
+    if (!followActivity) {
+        return;
+    }
+
+    QString assignedLayout = shouldSwitchToLayout(m_corona->m_activityConsumer->currentActivity());
+
+    if (!assignedLayout.isEmpty() && layoutExists(assignedLayout)) {
+        qDebug() << "speculative startup, switching to layout :: " << assignedLayout;
+        switchToLayout(assignedLayout);
+    }
+}
+
 void LayoutManager::loadLatteLayout(QString layoutPath)
 {
     qDebug() << " -------------------------------------------------------------------- ";
@@ -646,6 +684,8 @@ void LayoutManager::addLayout(Layout *layout)
 
 bool LayoutManager::switchToLayout(QString layoutName, int previousMemoryUsage)
 {
+    LATTE_TRACE_SCOPE("layouts", "LayoutManager::switchToLayout");
+
     if (m_activeLayouts.size() > 0 && currentLayoutName() == layoutName && previousMemoryUsage == -1) {
         return false;
     }
@@ -712,6 +752,8 @@ bool LayoutManager::switchToLayout(QString layoutName, int previousMemoryUsage)
         //! Latte was unstable and was crashing very often during changing
         //! sessions.
         QTimer::singleShot(350, [this, layoutName, lPath, previousMemoryUsage]() {
+            LATTE_TRACE_SCOPE("layouts", "LayoutManager::switchToLayout (unload/load)");
+
             qDebug() << layoutName << " - " << lPath;
             QString fixedLPath = lPath;
             QString fixedLayoutName = layoutName;
@@ -1112,6 +1154,12 @@ void LayoutManager::importPreset(int presetNo, bool newInstanceIfPresent)
 
 QStringList LayoutManager::validActivities(QStringList currentList)
 {
+    //! the activities can not be validated before the activities service is
+    //! running, they are kept as they are in order to not lose them
+    if (m_corona->m_activityConsumer->serviceStatus() != KActivities::Consumer::Running) {
+        return currentList;
+    }
+
     QStringList validIds;
 
     foreach (auto activity, currentList) {
@@ -22,6 +22,7 @@
 #define LAYOUTMANAGER_H
 
 // local
+#include "appletendpoints.h"
 #include "launcherssignals.h"
 #include "settings/settingsdialog.h"
 
@@ -43,6 +44,7 @@ class Controller;
 }
 
 namespace Latte {
+class AppletEndpoints;
 class Corona;
 class Importer;
 class Layout;
@@ -64,6 +66,7 @@ class LayoutManager : public QObject
     Q_PROPERTY(QStringList menuLayouts READ menuLayouts NOTIFY menuLayoutsChanged)
 
     Q_PROPERTY(LaunchersSignals *launchersSignals READ launchersSignals NOTIFY launchersSignalsChanged)
+    Q_PROPERTY(AppletEndpoints *appletEndpoints READ appletEndpoints CONSTANT)
 
 public:
     LayoutManager(QObject *parent = nullptr);
@@ -74,6 +77,10 @@ public:
 
     void load();
     void loadLayoutOnStartup(QString layoutName);
+    //! the activities service is running after a speculative startup,
+    //! when followActivity is true the layout assigned to the current
+    //! activity is loaded if it is not the speculatively loaded one
+    void confirmSpeculativeStartup(bool followActivity);
     void unload();
     void addView(Plasma::Containment *containment, bool forceLoading = false, int explicitScreen = -1);
     void hideAllViews();
@@ -104,6 +111,7 @@ public:
     //! returns the current and active layout based on activities and user preferences
     Layout *currentLayout() const;
 
+    AppletEndpoints *appletEndpoints();
     LaunchersSignals *launchersSignals();
 
     QStringList activities();
@@ -149,6 +157,7 @@ private:
     void cleanupOnStartup(QString path); //!remove deprecated or oldstyle config options
     void clearUnloadedContainmentsFromLinkedFile(QStringList containmentsIds, bool bypassChecks = false);
     void confirmDynamicSwitch();
+    void connectActivitiesSignals();
     //! it is used just in order to provide translations for the presets
     void ghostForTranslatedPresets();
     //! This function figures in the beginning if a view with tasks
@@ -185,6 +194,7 @@ private:
     QPointer<Latte::SettingsDialog> m_latteSettingsDialog;
 
     Latte::Corona *m_corona{nullptr};
+    AppletEndpoints *m_appletEndpoints{nullptr};
     Importer *m_importer{nullptr};
     LaunchersSignals *m_launchersSignals{nullptr};
 
@@ -22,6 +22,8 @@
 #include "config-latte.h"
 #include "importer.h"
 #include "lattecorona.h"
+#include "wm/windoweventsrecorder.h"
+#include "../liblatte2/tracer.h"
 #include "../liblatte2/types.h"
 
 // C++
@@ -107,6 +109,7 @@ int main(int argc, char **argv)
         , {"import-full", i18nc("command line", "Import full configuration."), i18nc("command line: import", "file_name")}
         , {"single", i18nc("command line", "Single layout memory mode. Only one layout is active at any case.")}
         , {"multiple", i18nc("command line", "Multiple layouts memory mode. Multiple layouts can be active at any time based on Activities running.")}
+        , {"trace", i18nc("command line", "Record a performance trace that can be opened with chrome://tracing or Perfetto. It is written when Latte closes."), i18nc("command line: trace", "file_name")}
     });
 
     //! START: Hidden options for Developer and Debugging usage
@@ -139,6 +142,18 @@ int main(int argc, char **argv)
     overloadedIconsOption.setDescription(QStringLiteral("Show visual indicators for debugging overloaded applets icons (Only useful to devs)."));
     overloadedIconsOption.setHidden(true);
     parser.addOption(overloadedIconsOption);
+
+    QCommandLineOption simulatedWmOption(QStringList() << QStringLiteral("simulated-wm"));
+    simulatedWmOption.setDescription(QStringLiteral("Use an in-memory window system driven from the given script file (Only useful to devs)."));
+    simulatedWmOption.setValueName(QStringLiteral("script_file"));
+    simulatedWmOption.setHidden(true);
+    parser.addOption(simulatedWmOption);
+
+    QCommandLineOption recordWmOption(QStringList() << QStringLiteral("record-wm"));
+    recordWmOption.setDescription(QStringLiteral("Record the window system events to the given file, it can be replayed with --simulated-wm (Only useful to devs)."));
+    recordWmOption.setValueName(QStringLiteral("file_name"));
+    recordWmOption.setHidden(true);
+    parser.addOption(recordWmOption);
     //! END: Hidden options
 
     parser.process(app);
@@ -253,12 +268,20 @@ int main(int argc, char **argv)
     std::signal(SIGKILL, signal_handler);
     std::signal(SIGINT, signal_handler);
 
+    if (parser.isSet(QStringLiteral("trace"))) {
+        Latte::Tracer::self()->start(parser.value(QStringLiteral("trace")));
+    }
+
     KCrash::setDrKonqiEnabled(true);
     KCrash::setFlags(KCrash::AutoRestart | KCrash::AlwaysDirectly);
 
-    Latte::Corona corona(defaultLayoutOnStartup, layoutNameOnStartup, memoryUsage);
+    Latte::Corona corona(defaultLayoutOnStartup, layoutNameOnStartup, memoryUsage, parser.value(QStringLiteral("simulated-wm")));
     KDBusService service(KDBusService::Unique);
 
+    if (parser.isSet(QStringLiteral("record-wm"))) {
+        new Latte::WindowEventsRecorder(corona.wm(), parser.value(QStringLiteral("record-wm")), &corona);
+    }
+
     return app.exec();
 }
 
@@ -152,8 +152,12 @@ void Theme::setOriginalSchemeFile(const QString &file)
 
     qDebug() << "plasma theme original colors ::: " << m_originalSchemePath;
 
-    updateDefaultScheme();
-    updateReversedScheme();
+    //! the original scheme is parsed only once and the derived schemes are
+    //! calculated in memory, their files are written only when they are needed
+    KSharedConfigPtr originalPtr = KSharedConfig::openConfig(m_originalSchemePath);
+
+    updateDefaultScheme(originalPtr);
+    updateReversedScheme(originalPtr);
 
     loadThemeLightness();
 
@@ -164,122 +168,97 @@ void Theme::setOriginalSchemeFile(const QString &file)
 //! plasma will use in order to be consistent. Such an example
 //! are the Breeze color schemes that have different values for
 //! WM and the plasma theme records
-void Theme::updateDefaultScheme()
+void Theme::updateDefaultScheme(KSharedConfigPtr originalPtr)
 {
-    QString defaultFilePath = m_extendedThemeDir.path() + "/" + DEFAULTCOLORSCHEME;
-    if (QFileInfo(defaultFilePath).exists()) {
-        QFile(defaultFilePath).remove();
-    }
+    m_defaultSchemePath = m_extendedThemeDir.path() + "/" + DEFAULTCOLORSCHEME;
 
-    QFile(m_originalSchemePath).copy(defaultFilePath);
-    m_defaultSchemePath = defaultFilePath;
+    KConfig *defaultConfig = originalPtr->copyTo(m_defaultSchemePath);
+    updateDefaultSchemeValues(originalPtr, defaultConfig);
 
-    updateDefaultSchemeValues();
-
-    if (m_defaultScheme) {
-        disconnect(m_defaultScheme, &SchemeColors::colorsChanged, this, &Theme::loadThemeLightness);
-        m_defaultScheme->deleteLater();
+    if (!m_defaultScheme) {
+        m_defaultScheme = new SchemeColors(this, defaultConfig, m_defaultSchemePath, true);
+        connect(m_defaultScheme, &SchemeColors::colorsChanged, this, &Theme::loadThemeLightness);
+    } else {
+        m_defaultScheme->setSchemeConfig(defaultConfig, m_defaultSchemePath);
     }
 
-    m_defaultScheme = new SchemeColors(this, m_defaultSchemePath, true);
-    connect(m_defaultScheme, &SchemeColors::colorsChanged, this, &Theme::loadThemeLightness);
-
     qDebug() << "plasma theme default colors ::: " << m_defaultSchemePath;
 }
 
-void Theme::updateDefaultSchemeValues()
+void Theme::updateDefaultSchemeValues(KSharedConfigPtr originalPtr, KConfig *defaultConfig)
 {
     //! update WM values based on original scheme
-    KSharedConfigPtr originalPtr = KSharedConfig::openConfig(m_originalSchemePath);
-    KSharedConfigPtr defaultPtr = KSharedConfig::openConfig(m_defaultSchemePath);
-
-    if (originalPtr && defaultPtr) {
+    if (originalPtr && defaultConfig) {
         KConfigGroup originalViewGroup(originalPtr, "Colors:View");
-        KConfigGroup defaultWMGroup(defaultPtr, "WM");
+        KConfigGroup defaultWMGroup(defaultConfig, "WM");
 
         defaultWMGroup.writeEntry("activeBackground", originalViewGroup.readEntry("BackgroundNormal", QColor()));
         defaultWMGroup.writeEntry("activeForeground", originalViewGroup.readEntry("ForegroundNormal", QColor()));
-
-        defaultWMGroup.sync();
     }
 }
 
-void Theme::updateReversedScheme()
+void Theme::updateReversedScheme(KSharedConfigPtr originalPtr)
 {
-    QString reversedFilePath = m_extendedThemeDir.path() + "/" + REVERSEDCOLORSCHEME;
+    m_reversedSchemePath = m_extendedThemeDir.path() + "/" + REVERSEDCOLORSCHEME;
 
-    if (QFileInfo(reversedFilePath).exists()) {
-        QFile(reversedFilePath).remove();
-    }
-
-    QFile(m_originalSchemePath).copy(reversedFilePath);
-    m_reversedSchemePath = reversedFilePath;
+    KConfig *reversedConfig = originalPtr->copyTo(m_reversedSchemePath);
+    updateReversedSchemeValues(originalPtr, reversedConfig);
 
-    updateReversedSchemeValues();
-
-    if (m_reversedScheme) {
-        m_reversedScheme->deleteLater();
+    if (!m_reversedScheme) {
+        m_reversedScheme = new SchemeColors(this, reversedConfig, m_reversedSchemePath, true);
+    } else {
+        m_reversedScheme->setSchemeConfig(reversedConfig, m_reversedSchemePath);
     }
 
-    m_reversedScheme = new SchemeColors(this, m_reversedSchemePath, true);
-
     qDebug() << "plasma theme reversed colors ::: " << m_reversedSchemePath;
 }
 
-void Theme::updateReversedSchemeValues()
+void Theme::updateReversedSchemeValues(KSharedConfigPtr originalPtr, KConfig *reversedConfig)
 {
     //! reverse values based on original scheme
-    KSharedConfigPtr originalPtr = KSharedConfig::openConfig(m_originalSchemePath);
-    KSharedConfigPtr reversedPtr = KSharedConfig::openConfig(m_reversedSchemePath);
-
-    if (originalPtr && reversedPtr) {
-        foreach (auto groupName, reversedPtr->groupList()) {
+    if (originalPtr && reversedConfig) {
+        foreach (auto groupName, reversedConfig->groupList()) {
             if (groupName != "Colors:Button") {
-                KConfigGroup reversedGroup(reversedPtr, groupName);
+                KConfigGroup reversedGroup(reversedConfig, groupName);
 
-                if (reversedGroup.keyList().contains("BackgroundNormal")
-                    && reversedGroup.keyList().contains("ForegroundNormal")) {
+                if (reversedGroup.hasKey("BackgroundNormal")
+                    && reversedGroup.hasKey("ForegroundNormal")) {
                     //! reverse usual text/background values
                     KConfigGroup originalGroup(originalPtr, groupName);
 
                     reversedGroup.writeEntry("BackgroundNormal", originalGroup.readEntry("ForegroundNormal", QColor()));
                     reversedGroup.writeEntry("ForegroundNormal", originalGroup.readEntry("BackgroundNormal", QColor()));
-
-                    reversedGroup.sync();
                 }
             }
         }
 
         //! update WM group
-        KConfigGroup reversedWMGroup(reversedPtr, "WM");
+        KConfigGroup reversedWMGroup(reversedConfig, "WM");
         KConfigGroup originalViewGroup(originalPtr, "Colors:View");
 
-        if (reversedWMGroup.keyList().contains("activeBackground")
-            && reversedWMGroup.keyList().contains("activeForeground")
-            && reversedWMGroup.keyList().contains("inactiveBackground")
-            && reversedWMGroup.keyList().contains("inactiveForeground")) {
+        if (reversedWMGroup.hasKey("activeBackground")
+            && reversedWMGroup.hasKey("activeForeground")
+            && reversedWMGroup.hasKey("inactiveBackground")
+            && reversedWMGroup.hasKey("inactiveForeground")) {
             //! reverse usual wm titlebar values
             KConfigGroup originalGroup(originalPtr, "WM");
             reversedWMGroup.writeEntry("activeBackground", originalViewGroup.readEntry("ForegroundNormal", QColor()));
             reversedWMGroup.writeEntry("activeForeground", originalViewGroup.readEntry("BackgroundNormal", QColor()));
             reversedWMGroup.writeEntry("inactiveBackground", originalGroup.readEntry("inactiveForeground", QColor()));
             reversedWMGroup.writeEntry("inactiveForeground", originalGroup.readEntry("inactiveBackground", QColor()));
-            reversedWMGroup.sync();
         }
 
-        if (reversedWMGroup.keyList().contains("activeBlend")
-            && reversedWMGroup.keyList().contains("inactiveBlend")) {
+        if (reversedWMGroup.hasKey("activeBlend")
+            && reversedWMGroup.hasKey("inactiveBlend")) {
             KConfigGroup originalGroup(originalPtr, "WM");
             reversedWMGroup.writeEntry("activeBlend", originalGroup.readEntry("inactiveBlend", QColor()));
             reversedWMGroup.writeEntry("inactiveBlend", originalGroup.readEntry("activeBlend", QColor()));
-            reversedWMGroup.sync();
         }
 
         //! update scheme name
         QString originalSchemeName = SchemeColors::schemeName(m_originalSchemePath);
-        KConfigGroup generalGroup(reversedPtr, "General");
+        KConfigGroup generalGroup(reversedConfig, "General");
         generalGroup.writeEntry("Name", originalSchemeName + "_reversed");
-        generalGroup.sync();
     }
 }
 
@@ -32,6 +32,7 @@
 #include <QTemporaryDir>
 
 // KDE
+#include <KConfig>
 #include <KConfigGroup>
 #include <KSharedConfig>
 
@@ -98,10 +99,10 @@ private:
     void loadRoundness();
 
     void setOriginalSchemeFile(const QString &file);
-    void updateDefaultScheme();
-    void updateDefaultSchemeValues();
-    void updateReversedScheme();
-    void updateReversedSchemeValues();
+    void updateDefaultScheme(KSharedConfigPtr originalPtr);
+    void updateDefaultSchemeValues(KSharedConfigPtr originalPtr, KConfig *defaultConfig);
+    void updateReversedScheme(KSharedConfigPtr originalPtr);
+    void updateReversedSchemeValues(KSharedConfigPtr originalPtr, KConfig *reversedConfig);
 
     bool themeHasExtendedInfo() const;
 
@@ -0,0 +1,124 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "qmlcomponentscache.h"
+
+// Qt
+#include <QDebug>
+#include <QQmlComponent>
+#include <QQmlEngine>
+
+// KDE
+#include <KDeclarative/QmlObjectSharedEngine>
+#include <KPackage/Package>
+#include <KPackage/PackageLoader>
+
+namespace Latte {
+
+QmlComponentsCache::QmlComponentsCache(QObject *parent)
+    : QObject(parent)
+{
+    m_packages << QStringLiteral("org.kde.latte.containment")
+               << QStringLiteral("org.kde.latte.plasmoid");
+}
+
+QmlComponentsCache::~QmlComponentsCache()
+{
+    qDeleteAll(m_components);
+    m_components.clear();
+
+    if (m_sharedEngine) {
+        delete m_sharedEngine;
+    }
+}
+
+void QmlComponentsCache::warmUp()
+{
+    if (m_sharedEngine) {
+        return;
+    }
+
+    m_sharedEngine = new KDeclarative::QmlObjectSharedEngine();
+
+    for (const auto &pluginId : m_packages) {
+        addPackage(pluginId);
+    }
+}
+
+bool QmlComponentsCache::isReady() const
+{
+    if (!m_sharedEngine) {
+        return false;
+    }
+
+    for (const auto component : m_components) {
+        if (component->isLoading()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void QmlComponentsCache::addPackage(const QString &pluginId)
+{
+    KPackage::Package package = KPackage::PackageLoader::self()->loadPackage(QStringLiteral("Plasma/Applet"), pluginId);
+
+    if (!package.isValid()) {
+        qWarning() << "Components cache, package can not be loaded ::: " << pluginId;
+        return;
+    }
+
+    const QString mainScript = package.filePath("mainscript");
+
+    if (mainScript.isEmpty()) {
+        return;
+    }
+
+    QQmlComponent *component = new QQmlComponent(m_sharedEngine->engine(), nullptr);
+    connect(component, &QQmlComponent::statusChanged, this, &QmlComponentsCache::componentStatusChanged);
+
+    m_components << component;
+
+    component->loadUrl(QUrl::fromLocalFile(mainScript), QQmlComponent::Asynchronous);
+}
+
+void QmlComponentsCache::componentStatusChanged()
+{
+    QQmlComponent *component = qobject_cast<QQmlComponent *>(sender());
+
+    if (!component || component->isLoading()) {
+        return;
+    }
+
+    if (component->isError()) {
+        qWarning() << "Components cache, compilation failed ::: " << component->url() << component->errorString();
+        m_components.removeAll(component);
+        component->deleteLater();
+    } else {
+        qDebug() << "Components cache, compiled ::: " << component->url();
+    }
+
+    if (isReady()) {
+        emit ready();
+    }
+}
+
+}
@@ -0,0 +1,74 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef QMLCOMPONENTSCACHE_H
+#define QMLCOMPONENTSCACHE_H
+
+// Qt
+#include <QList>
+#include <QObject>
+#include <QStringList>
+
+class QQmlComponent;
+
+namespace KDeclarative {
+class QmlObjectSharedEngine;
+}
+
+namespace Latte {
+
+//! It compiles asynchronously the main scripts of the Latte containment and
+//! plasmoid packages in the qml engine that is shared by all applets and keeps
+//! the compiled components alive. The views that are created afterwards, e.g.
+//! for a new screen or after a layout switch, find their types already
+//! compiled instead of parsing them again on the GUI thread
+class QmlComponentsCache : public QObject
+{
+    Q_OBJECT
+
+public:
+    QmlComponentsCache(QObject *parent = nullptr);
+    ~QmlComponentsCache() override;
+
+    void warmUp();
+
+    //! all the requested components have been compiled
+    bool isReady() const;
+
+signals:
+    void ready();
+
+private slots:
+    void componentStatusChanged();
+
+private:
+    void addPackage(const QString &pluginId);
+
+private:
+    QStringList m_packages;
+    QList<QQmlComponent *> m_components;
+
+    //! it keeps the shared engine alive even when no view is present
+    KDeclarative::QmlObjectSharedEngine *m_sharedEngine{nullptr};
+};
+
+}
+
+#endif
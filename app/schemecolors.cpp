@@ -23,9 +23,11 @@
 // Qt
 #include <QDebug>
 #include <QDir>
+#include <QFile>
 #include <QFileInfo>
 
 // KDE
+#include <KConfig>
 #include <KConfigGroup>
 #include <KDirWatch>
 #include <KSharedConfig>
@@ -55,9 +57,20 @@ SchemeColors::SchemeColors(QObject *parent, QString scheme, bool plasmaTheme) :
     updateScheme();
 }
 
+SchemeColors::SchemeColors(QObject *parent, KConfig *config, QString file, bool plasmaTheme) :
+    QObject(parent),
+    m_basedOnPlasmaTheme(plasmaTheme)
+{
+    setSchemeConfig(config, file);
+}
+
 SchemeColors::~SchemeColors()
 {
-///
+    if (m_schemeConfig) {
+        //! in-memory schemes must not be written on deletion
+        m_schemeConfig->markAsClean();
+        delete m_schemeConfig;
+    }
 }
 
 QColor SchemeColors::backgroundColor() const
@@ -145,6 +158,52 @@ void SchemeColors::setSchemeFile(QString file)
     emit schemeFileChanged();
 }
 
+void SchemeColors::setSchemeConfig(KConfig *config, QString file)
+{
+    if (!config) {
+        return;
+    }
+
+    if (m_schemeConfig && m_schemeConfig != config) {
+        m_schemeConfig->markAsClean();
+        delete m_schemeConfig;
+    }
+
+    m_schemeConfig = config;
+
+    KConfigGroup generalGroup(m_schemeConfig, "General");
+    m_schemeName = generalGroup.readEntry("Name", QString());
+
+    bool fileChanged = (m_schemeFile != file);
+    m_schemeFile = file;
+
+    //! the file is written once for every new scheme and before it is
+    //! published, consumers can use the scheme file directly
+    writeSchemeFile();
+    loadColors(m_schemeConfig);
+
+    if (fileChanged) {
+        emit schemeFileChanged();
+    }
+}
+
+void SchemeColors::writeSchemeFile()
+{
+    if (!m_schemeConfig || m_schemeFile.isEmpty()) {
+        return;
+    }
+
+    //! the file is removed first, otherwise sync() would merge
+    //! the entries with the ones of the previous scheme
+    if (QFileInfo(m_schemeFile).exists()) {
+        QFile(m_schemeFile).remove();
+    }
+
+    m_schemeConfig->sync();
+
+    qDebug() << "scheme file written ::: " << m_schemeFile;
+}
+
 QString SchemeColors::possibleSchemeFile(QString scheme)
 {
     if (scheme.startsWith("/") && scheme.endsWith("colors") && QFileInfo(scheme).exists()) {
@@ -209,11 +268,16 @@ void SchemeColors::updateScheme()
     }
 
     KSharedConfigPtr filePtr = KSharedConfig::openConfig(m_schemeFile);
-    KConfigGroup wmGroup = KConfigGroup(filePtr, "WM");
-    KConfigGroup selGroup = KConfigGroup(filePtr, "Colors:Selection");
-    KConfigGroup viewGroup = KConfigGroup(filePtr, "Colors:View");
-    //KConfigGroup windowGroup = KConfigGroup(filePtr, "Colors:Window");
-    KConfigGroup buttonGroup = KConfigGroup(filePtr, "Colors:Button");
+    loadColors(filePtr.data());
+}
+
+void SchemeColors::loadColors(KConfigBase *config)
+{
+    KConfigGroup wmGroup = KConfigGroup(config, "WM");
+    KConfigGroup selGroup = KConfigGroup(config, "Colors:Selection");
+    KConfigGroup viewGroup = KConfigGroup(config, "Colors:View");
+    //KConfigGroup windowGroup = KConfigGroup(config, "Colors:Window");
+    KConfigGroup buttonGroup = KConfigGroup(config, "Colors:Button");
 
     if (!m_basedOnPlasmaTheme) {
         m_activeBackgroundColor = wmGroup.readEntry("activeBackground", QColor());
@@ -25,6 +25,9 @@
 #include <QObject>
 #include <QColor>
 
+class KConfig;
+class KConfigBase;
+
 namespace Latte {
 
 class SchemeColors: public QObject
@@ -50,6 +53,9 @@ class SchemeColors: public QObject
 
 public:
     SchemeColors(QObject *parent, QString scheme, bool plasmaTheme = false);
+    //! in-memory scheme, it is parsed only once and its file is written
+    //! whenever a new scheme config is set
+    SchemeColors(QObject *parent, KConfig *config, QString file, bool plasmaTheme = false);
     ~SchemeColors() override;
 
     QString schemeName() const;
@@ -57,6 +63,9 @@ public:
     QString schemeFile() const;
     void setSchemeFile(QString file);
 
+    //! takes ownership of config
+    void setSchemeConfig(KConfig *config, QString file);
+
     QColor backgroundColor() const;
     QColor textColor() const;
     QColor inactiveBackgroundColor() const;
@@ -82,6 +91,10 @@ signals:
 private slots:
     void updateScheme();
 
+private:
+    void loadColors(KConfigBase *config);
+    void writeSchemeFile();
+
 private:
     bool m_basedOnPlasmaTheme{false};
 
@@ -104,6 +117,8 @@ private:
     QColor m_buttonBackgroundColor;
     QColor m_buttonHoverColor;
     QColor m_buttonFocusColor;
+
+    KConfig *m_schemeConfig{nullptr};
 };
 
 }
@@ -0,0 +1,172 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "screentopology.h"
+
+// local
+#include "screenpool.h"
+
+// Qt
+#include <QDebug>
+#include <QGuiApplication>
+#include <QScreen>
+
+namespace Latte {
+
+ScreenTopology::ScreenTopology(ScreenPool *pool, QObject *parent)
+    : QObject(parent),
+      m_screenPool(pool)
+{
+    qRegisterMetaType<Latte::ScreenTopologyDiff>("Latte::ScreenTopologyDiff");
+
+    m_updateTimer.setSingleShot(true);
+    m_updateTimer.setInterval(2500);
+    connect(&m_updateTimer, &QTimer::timeout, this, &ScreenTopology::update);
+
+    takeSnapshot(m_geometries, m_primary);
+
+    for (QScreen *screen : qGuiApp->screens()) {
+        trackScreen(screen);
+    }
+
+    connect(qGuiApp, &QGuiApplication::screenAdded, this, [&](QScreen *screen) {
+        trackScreen(screen);
+        scheduleUpdate();
+    });
+
+    connect(qGuiApp, &QGuiApplication::screenRemoved, this, &ScreenTopology::scheduleUpdate);
+    connect(qGuiApp, &QGuiApplication::primaryScreenChanged, this, &ScreenTopology::scheduleUpdate);
+
+    //! RandR notifications for the case that the only enabled screen is
+    //! switched and Qt recycles the same QScreen
+    if (m_screenPool) {
+        connect(m_screenPool, &ScreenPool::primaryPoolChanged, this, &ScreenTopology::scheduleUpdate);
+    }
+}
+
+ScreenTopology::~ScreenTopology()
+{
+    m_updateTimer.stop();
+}
+
+int ScreenTopology::interval() const
+{
+    return m_updateTimer.interval();
+}
+
+void ScreenTopology::setInterval(int interval)
+{
+    m_updateTimer.setInterval(interval);
+}
+
+QString ScreenTopology::primaryScreen() const
+{
+    return m_primary;
+}
+
+QStringList ScreenTopology::screens() const
+{
+    return m_geometries.keys();
+}
+
+bool ScreenTopology::contains(const QString &name) const
+{
+    return m_geometries.contains(name);
+}
+
+void ScreenTopology::resetSnapshot()
+{
+    m_updateTimer.stop();
+    takeSnapshot(m_geometries, m_primary);
+}
+
+void ScreenTopology::trackScreen(QScreen *screen)
+{
+    if (!screen) {
+        return;
+    }
+
+    connect(screen, &QScreen::geometryChanged, this, &ScreenTopology::scheduleUpdate, Qt::UniqueConnection);
+}
+
+void ScreenTopology::scheduleUpdate()
+{
+    //! the timer is not restarted in order to not postpone forever
+    //! the update when the window system sends a burst of events
+    if (!m_updateTimer.isActive()) {
+        m_updateTimer.start();
+    }
+}
+
+void ScreenTopology::takeSnapshot(QHash<QString, QRect> &geometries, QString &primary) const
+{
+    geometries.clear();
+
+    for (const QScreen *screen : qGuiApp->screens()) {
+        //! the ":" check ignores the strange plasma/qt screen names
+        //! such as "0:0" that are reported during changes
+        if (screen->name().isEmpty() || screen->name().startsWith(":")) {
+            continue;
+        }
+
+        geometries[screen->name()] = screen->geometry();
+    }
+
+    primary = qGuiApp->primaryScreen() ? qGuiApp->primaryScreen()->name() : QString();
+}
+
+void ScreenTopology::update()
+{
+    QHash<QString, QRect> geometries;
+    QString primary;
+
+    takeSnapshot(geometries, primary);
+
+    ScreenTopologyDiff diff;
+    diff.previousPrimary = m_primary;
+    diff.primary = primary;
+
+    for (auto it = geometries.constBegin(); it != geometries.constEnd(); ++it) {
+        if (!m_geometries.contains(it.key())) {
+            diff.added << it.key();
+        } else if (m_geometries.value(it.key()) != it.value()) {
+            diff.geometryChanged << it.key();
+        }
+    }
+
+    for (auto it = m_geometries.constBegin(); it != m_geometries.constEnd(); ++it) {
+        if (!geometries.contains(it.key())) {
+            diff.removed << it.key();
+        }
+    }
+
+    m_geometries = geometries;
+    m_primary = primary;
+
+    if (diff.isEmpty()) {
+        return;
+    }
+
+    qDebug() << "screen topology changed, added:" << diff.added << " removed:" << diff.removed
+             << " geometry:" << diff.geometryChanged << " primary:" << diff.previousPrimary << "->" << diff.primary;
+
+    emit topologyChanged(diff);
+}
+
+}
@@ -0,0 +1,115 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SCREENTOPOLOGY_H
+#define SCREENTOPOLOGY_H
+
+// Qt
+#include <QHash>
+#include <QMetaType>
+#include <QObject>
+#include <QRect>
+#include <QStringList>
+#include <QTimer>
+
+class QScreen;
+
+namespace Latte {
+class ScreenPool;
+}
+
+namespace Latte {
+
+//! the difference between two consecutive screen topology snapshots
+struct ScreenTopologyDiff {
+    QStringList added;
+    QStringList removed;
+    QStringList geometryChanged;
+
+    QString previousPrimary;
+    QString primary;
+
+    bool primaryChanged() const {
+        return previousPrimary != primary;
+    }
+
+    //! screens were added/removed or the primary screen moved,
+    //! the views must be redistributed to screens
+    bool outputsChanged() const {
+        return !added.isEmpty() || !removed.isEmpty() || primaryChanged();
+    }
+
+    bool isEmpty() const {
+        return !outputsChanged() && geometryChanged.isEmpty();
+    }
+};
+
+//! It consumes the screen change events from Qt (and RandR through ScreenPool)
+//! once for the entire application, compresses them for the given interval
+//! and afterwards publishes a single topology diff. Consumers do not need
+//! to poll the screens anymore, they are only triggered when something
+//! actually changed
+class ScreenTopology : public QObject
+{
+    Q_OBJECT
+
+public:
+    ScreenTopology(ScreenPool *pool, QObject *parent = nullptr);
+    ~ScreenTopology() override;
+
+    int interval() const;
+    void setInterval(int interval);
+
+    QString primaryScreen() const;
+    QStringList screens() const;
+
+    bool contains(const QString &name) const;
+
+    //! takes a new snapshot without publishing a diff, it is used when a
+    //! consumer starts to follow the topology and reads the current screens
+    void resetSnapshot();
+
+public slots:
+    //! request a topology re-evaluation, consecutive requests are compressed
+    void scheduleUpdate();
+
+signals:
+    void topologyChanged(const Latte::ScreenTopologyDiff &diff);
+
+private slots:
+    void update();
+
+private:
+    void trackScreen(QScreen *screen);
+    void takeSnapshot(QHash<QString, QRect> &geometries, QString &primary) const;
+
+private:
+    QString m_primary;
+    QHash<QString, QRect> m_geometries;
+
+    QTimer m_updateTimer;
+
+    ScreenPool *m_screenPool{nullptr};
+};
+
+}
+
+Q_DECLARE_METATYPE(Latte::ScreenTopologyDiff)
+
+#endif
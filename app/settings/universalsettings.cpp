@@ -39,16 +39,20 @@ namespace Latte {
 
 UniversalSettings::UniversalSettings(KSharedConfig::Ptr config, QObject *parent)
     : QObject(parent),
+      m_launchersStore(new LaunchersStore(this)),
       m_config(config),
       m_universalGroup(KConfigGroup(config, QStringLiteral("UniversalSettings")))
 {
     m_corona = qobject_cast<Latte::Corona *>(parent);
 
+    connect(m_launchersStore, &LaunchersStore::launchersChanged, this, &UniversalSettings::launchersChanged);
+
     connect(this, &UniversalSettings::canDisableBordersChanged, this, &UniversalSettings::saveConfig);
     connect(this, &UniversalSettings::currentLayoutNameChanged, this, &UniversalSettings::saveConfig);
     connect(this, &UniversalSettings::downloadWindowSizeChanged, this, &UniversalSettings::saveConfig);
     connect(this, &UniversalSettings::lastNonAssignedLayoutNameChanged, this, &UniversalSettings::saveConfig);
-    connect(this, &UniversalSettings::launchersChanged, this, &UniversalSettings::saveConfig);
+    //! launchers are changing in bursts, e.g. when they are dragged around
+    connect(m_launchersStore, &LaunchersStore::persistRequested, this, &UniversalSettings::saveConfig);
     connect(this, &UniversalSettings::layoutsColumnWidthsChanged, this, &UniversalSettings::saveConfig);
     connect(this, &UniversalSettings::layoutsMemoryUsageChanged, this, &UniversalSettings::saveConfig);
     connect(this, &UniversalSettings::layoutsWindowSizeChanged, this, &UniversalSettings::saveConfig);
@@ -205,17 +209,17 @@ void UniversalSettings::setLayoutsColumnWidths(QStringList widths)
 
 QStringList UniversalSettings::launchers() const
 {
-    return m_launchers;
+    return m_launchersStore->launchers();
 }
 
 void UniversalSettings::setLaunchers(QStringList launcherList)
 {
-    if (m_launchers == launcherList) {
-        return;
-    }
+    m_launchersStore->setLaunchers(launcherList);
+}
 
-    m_launchers = launcherList;
-    emit launchersChanged();
+LaunchersStore *UniversalSettings::launchersStore() const
+{
+    return m_launchersStore;
 }
 
 
@@ -382,7 +386,7 @@ void UniversalSettings::loadConfig()
     m_lastNonAssignedLayoutName = m_universalGroup.readEntry("lastNonAssignedLayout", QString());
     m_layoutsWindowSize = m_universalGroup.readEntry("layoutsWindowSize", QSize(700, 450));
     m_layoutsColumnWidths = m_universalGroup.readEntry("layoutsColumnWidths", QStringList());
-    m_launchers = m_universalGroup.readEntry("launchers", QStringList());
+    m_launchersStore->loadLaunchers(m_universalGroup.readEntry("launchers", QStringList()));
     m_metaPressAndHoldEnabled = m_universalGroup.readEntry("metaPressAndHoldEnabled", true);
     m_screenTrackerInterval = m_universalGroup.readEntry("screenTrackerInterval", 2500);
     m_showInfoWindow = m_universalGroup.readEntry("showInfoWindow", true);
@@ -399,7 +403,7 @@ void UniversalSettings::saveConfig()
     m_universalGroup.writeEntry("lastNonAssignedLayout", m_lastNonAssignedLayoutName);
     m_universalGroup.writeEntry("layoutsWindowSize", m_layoutsWindowSize);
     m_universalGroup.writeEntry("layoutsColumnWidths", m_layoutsColumnWidths);
-    m_universalGroup.writeEntry("launchers", m_launchers);
+    m_universalGroup.writeEntry("launchers", m_launchersStore->launchers());
     m_universalGroup.writeEntry("metaPressAndHoldEnabled", m_metaPressAndHoldEnabled);
     m_universalGroup.writeEntry("screenTrackerInterval", m_screenTrackerInterval);
     m_universalGroup.writeEntry("showInfoWindow", m_showInfoWindow);
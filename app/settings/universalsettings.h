@@ -23,6 +23,7 @@
 
 // local
 #include "../lattecorona.h"
+#include "../liblatte2/launchersstore.h"
 #include "../liblatte2/types.h"
 
 // Qt
@@ -53,6 +54,8 @@ class UniversalSettings : public QObject
 
     Q_PROPERTY(QStringList launchers READ launchers WRITE setLaunchers NOTIFY launchersChanged)
 
+    Q_PROPERTY(Latte::LaunchersStore *launchersStore READ launchersStore CONSTANT)
+
     Q_PROPERTY(Latte::Types::MouseSensitivity mouseSensitivity READ mouseSensitivity WRITE setMouseSensitivity NOTIFY mouseSensitivityChanged)
 
     Q_PROPERTY(QQmlListProperty<QScreen> screens READ screens)
@@ -102,6 +105,9 @@ public:
     QStringList launchers() const;
     void setLaunchers(QStringList launcherList);
 
+    //! the global launchers, shared by all the plasmoids that use them
+    LaunchersStore *launchersStore() const;
+
     Types::MouseSensitivity mouseSensitivity() const;
     void setMouseSensitivity(Types::MouseSensitivity sensitivity);
 
@@ -158,13 +164,14 @@ private:
     QSize m_layoutsWindowSize{700, 450};
 
     QStringList m_layoutsColumnWidths;
-    QStringList m_launchers;
 
     Types::LayoutsMemoryUsage m_memoryUsage;
     Types::MouseSensitivity m_mouseSensitivity{Types::HighSensitivity};
 
     QPointer<Latte::Corona> m_corona;
 
+    LaunchersStore *m_launchersStore{nullptr};
+
     KConfigGroup m_universalGroup;
     KSharedConfig::Ptr m_config;
 
@@ -23,6 +23,7 @@
 // local
 #include "modifiertracker.h"
 #include "shortcutstracker.h"
+#include "../appletendpoints.h"
 #include "../lattecorona.h"
 #include "../layoutmanager.h"
 #include "../layout/layout.h"
@@ -52,6 +53,9 @@
 namespace Latte {
 
 const int APPLETEXECUTIONDELAY = 400;
+//! X11 modifiers release is tracked through events, the timer is used only
+//! as safety net in case a release event was lost
+const int HIDEVIEWSFALLBACKDELAY = 1500;
 
 GlobalShortcuts::GlobalShortcuts(QObject *parent)
     : QObject(parent)
@@ -67,9 +71,17 @@ GlobalShortcuts::GlobalShortcuts(QObject *parent)
     m_hideViewsTimer.setSingleShot(true);
 
     if (QX11Info::isPlatformX11()) {
-        //in X11 the timer is a poller that checks to see if the modifier keys
-        //from user global shortcut have been released
-        m_hideViewsTimer.setInterval(300);
+        if (m_modifierTracker->modifiersEventsAvailable()) {
+            //the views are hidden as soon as the modifier keys from user global
+            //shortcut have been released
+            m_hideViewsTimer.setInterval(HIDEVIEWSFALLBACKDELAY);
+            connect(m_modifierTracker, &ShortcutsPart::ModifierTracker::modifiersChanged,
+                    this, &GlobalShortcuts::hideViewsOnModifiersRelease);
+        } else {
+            //in X11 the timer is a poller that checks to see if the modifier keys
+            //from user global shortcut have been released
+            m_hideViewsTimer.setInterval(300);
+        }
     } else {
         //on wayland in acting just as simple timer that hides the view afterwards
         m_hideViewsTimer.setInterval(2500);
@@ -326,58 +338,38 @@ bool GlobalShortcuts::activatePlasmaTaskManagerEntryAtContainment(const Plasma::
 
 bool GlobalShortcuts::activateLatteEntryAtContainment(const Latte::View *view, int index, Qt::Key modifier)
 {
-    if (QQuickItem *containmentInterface = view->containment()->property("_plasma_graphicObject").value<QQuickItem *>()) {
-        const auto &childItems = containmentInterface->childItems();
-
-        for (QQuickItem *item : childItems) {
-            if (auto *metaObject = item->metaObject()) {
-                // not using QMetaObject::invokeMethod to avoid warnings when calling
-                // this on applets that don't have it or other child items since this
-                // is pretty much trial and error.
-
-                // Also, "var" arguments are treated as QVariant in QMetaObject
-                int methodIndex = modifier == static_cast<Qt::Key>(Qt::META) ?
-                            metaObject->indexOfMethod("activateEntryAtIndex(QVariant)") :
-                            metaObject->indexOfMethod("newInstanceForEntryAtIndex(QVariant)");
-
-                int methodIndex2 = metaObject->indexOfMethod("setShowAppletShortcutBadges(QVariant,QVariant,QVariant,QVariant)");
-
-                if (methodIndex == -1 || (methodIndex2 == -1)) {
-                    continue;
-                }
+    ContainmentEndpoint endpoint = m_corona->layoutManager()->appletEndpoints()->containmentEndpoint(view->containment());
 
-                int appLauncher = m_corona->universalSettings()->metaForwardedToLatte() ?
-                            applicationLauncherId(view->containment()) : -1;
+    if (!endpoint.item || !endpoint.setShowAppletShortcutBadges.isValid()) {
+        return false;
+    }
 
-                int showMethodIndex = -1;
+    QMetaMethod method = modifier == static_cast<Qt::Key>(Qt::META) ?
+                endpoint.activateEntryAtIndex : endpoint.newInstanceForEntryAtIndex;
 
-                if (!m_viewItemsCalled.contains(item)) {
-                    m_viewItemsCalled.append(item);
-                    m_showShortcutBadgesMethods.append(metaObject->method(methodIndex2));
-                    showMethodIndex = m_showShortcutBadgesMethods.count() - 1;
-                } else {
-                    showMethodIndex = m_showShortcutBadgesMethods.indexOf(metaObject->method(methodIndex2));
-                }
+    if (!method.isValid()) {
+        return false;
+    }
 
-                QMetaMethod method = metaObject->method(methodIndex);
+    if (!m_viewItemsCalled.contains(endpoint.item)) {
+        m_viewItemsCalled.append(endpoint.item);
+        m_showShortcutBadgesMethods.append(endpoint.setShowAppletShortcutBadges);
+    }
 
-                if (view->visibility()->isHidden()) {
-                    //! delay the execution in order to show first the view
-                    QTimer::singleShot(APPLETEXECUTIONDELAY, [this, item, method, index]() {
-                        method.invoke(item, Q_ARG(QVariant, index));
-                    });
+    if (view->visibility()->isHidden()) {
+        QPointer<QQuickItem> item = endpoint.item;
 
-                    return true;
-                } else {
-                    if (method.invoke(item, Q_ARG(QVariant, index))) {
-                        return true;
-                    }
-                }
+        //! delay the execution in order to show first the view
+        QTimer::singleShot(APPLETEXECUTIONDELAY, [this, item, method, index]() {
+            if (item) {
+                method.invoke(item, Q_ARG(QVariant, index));
             }
-        }
+        });
+
+        return true;
     }
 
-    return false;
+    return method.invoke(endpoint.item, Q_ARG(QVariant, index));
 }
 
 
@@ -418,58 +410,17 @@ void GlobalShortcuts::activateEntry(int index, Qt::Key modifier)
 void GlobalShortcuts::updateViewItemBadge(QString identifier, QString value)
 {
     //qDebug() << "DBUS CALL ::: " << identifier << " - " << value;
-    auto updateBadgeForTaskInContainment = [this](const Plasma::Containment * c, QString identifier, QString value) {
-        const auto &applets = c->applets();
-
-        for (auto *applet : applets) {
-            KPluginMetaData meta = applet->kPackage().metadata();
-
-            if (meta.pluginId() == "org.kde.latte.plasmoid") {
-
-                if (QQuickItem *appletInterface = applet->property("_plasma_graphicObject").value<QQuickItem *>()) {
-                    const auto &childItems = appletInterface->childItems();
-
-                    if (childItems.isEmpty()) {
-                        continue;
-                    }
-
-                    for (QQuickItem *item : childItems) {
-                        if (auto *metaObject = item->metaObject()) {
-                            // not using QMetaObject::invokeMethod to avoid warnings when calling
-                            // this on applets that don't have it or other child items since this
-                            // is pretty much trial and error.
-                            // Also, "var" arguments are treated as QVariant in QMetaObject
-
-                            int methodIndex = metaObject->indexOfMethod("updateBadge(QVariant,QVariant)");
-
-                            if (methodIndex == -1) {
-                                continue;
-                            }
-
-                            QMetaMethod method = metaObject->method(methodIndex);
-
-                            if (method.invoke(item, Q_ARG(QVariant, identifier), Q_ARG(QVariant, value))) {
-                                return true;
-                            }
-                        }
-                    }
-                }
-            }
-        }
-
-        return false;
-    };
-
-    QHash<const Plasma::Containment *, Latte::View *> *views;
     Layout *currentLayout = m_corona->layoutManager()->currentLayout();
 
-    if (currentLayout) {
-        views = currentLayout->latteViews();
+    if (!currentLayout) {
+        return;
     }
 
     // update badges in all Latte Tasks plasmoids
-    for (auto it = views->constBegin(), end = views->constEnd(); it != end; ++it) {
-        updateBadgeForTaskInContainment(it.key(), identifier, value);
+    const auto endpoints = m_corona->layoutManager()->appletEndpoints()->tasksEndpoints(currentLayout->name());
+
+    for (const auto &endpoint : endpoints) {
+        endpoint.updateBadge.invoke(endpoint.item, Q_ARG(QVariant, identifier), Q_ARG(QVariant, value));
     }
 }
 
@@ -479,30 +430,10 @@ bool GlobalShortcuts::isCapableToShowShortcutBadges(Latte::View *view)
         return false;
     }
 
-    const Plasma::Containment *c = view->containment();
-
-    if (QQuickItem *containmentInterface = c->property("_plasma_graphicObject").value<QQuickItem *>()) {
-        const auto &childItems = containmentInterface->childItems();
-
-        for (QQuickItem *item : childItems) {
-            if (auto *metaObject = item->metaObject()) {
-                // not using QMetaObject::invokeMethod to avoid warnings when calling
-                // this on applets that don't have it or other child items since this
-                // is pretty much trial and error.
-
-                // Also, "var" arguments are treated as QVariant in QMetaObject
-                int methodIndex = metaObject->indexOfMethod("setShowAppletShortcutBadges(QVariant,QVariant,QVariant,QVariant)");
-
-                if (methodIndex == -1) {
-                    continue;
-                }
-
-                return true;
-            }
-        }
-    }
+    AppletEndpoints *endpoints = m_corona->layoutManager()->appletEndpoints();
 
-    return false;
+    return endpoints->hasContainmentEndpoint(view->containment())
+            && endpoints->containmentEndpoint(view->containment()).setShowAppletShortcutBadges.isValid();
 }
 
 int GlobalShortcuts::applicationLauncherId(const Plasma::Containment *c)
@@ -528,93 +459,37 @@ void GlobalShortcuts::showViews()
         m_lastInvokedAction = m_singleMetaAction;
     }
 
-    auto invokeShowShortcuts = [this](const Plasma::Containment * c, const bool showLatteShortcuts, const bool showMeta) {
-        if (QQuickItem *containmentInterface = c->property("_plasma_graphicObject").value<QQuickItem *>()) {
-            const auto &childItems = containmentInterface->childItems();
-
-            for (QQuickItem *item : childItems) {
-                if (auto *metaObject = item->metaObject()) {
-                    // not using QMetaObject::invokeMethod to avoid warnings when calling
-                    // this on applets that don't have it or other child items since this
-                    // is pretty much trial and error.
-
-                    // Also, "var" arguments are treated as QVariant in QMetaObject
-                    int methodIndex = metaObject->indexOfMethod("setShowAppletShortcutBadges(QVariant,QVariant,QVariant,QVariant)");
-
-                    if (methodIndex == -1) {
-                        continue;
-                    }
-
-                    int appLauncher = m_corona->universalSettings()->metaForwardedToLatte() && showMeta ?
-                                applicationLauncherId(c) : -1;
+    auto invokeShowShortcutBadges = [this](const Plasma::Containment * c, const bool showLatteShortcuts, const bool showMeta, const int appLauncher) {
+        ContainmentEndpoint endpoint = m_corona->layoutManager()->appletEndpoints()->containmentEndpoint(c);
 
-                    int showMethodIndex = -1;
-
-                    if (!m_viewItemsCalled.contains(item)) {
-                        m_viewItemsCalled.append(item);
-                        m_showShortcutBadgesMethods.append(metaObject->method(methodIndex));
-                        showMethodIndex = m_showShortcutBadgesMethods.count() - 1;
-                    } else {
-                        showMethodIndex = m_showShortcutBadgesMethods.indexOf(metaObject->method(methodIndex));
-                    }
-
-                    if (m_showShortcutBadgesMethods[showMethodIndex].invoke(item,
-                                                                            Q_ARG(QVariant, showLatteShortcuts),
-                                                                            Q_ARG(QVariant, true),
-                                                                            Q_ARG(QVariant, showMeta),
-                                                                            Q_ARG(QVariant, appLauncher))) {
-                        return true;
-                    }
+        if (!endpoint.item || !endpoint.setShowAppletShortcutBadges.isValid()) {
+            return false;
+        }
 
-                }
-            }
+        if (!m_viewItemsCalled.contains(endpoint.item)) {
+            m_viewItemsCalled.append(endpoint.item);
+            m_showShortcutBadgesMethods.append(endpoint.setShowAppletShortcutBadges);
         }
 
-        return false;
+        return endpoint.setShowAppletShortcutBadges.invoke(endpoint.item,
+                                                           Q_ARG(QVariant, showLatteShortcuts),
+                                                           Q_ARG(QVariant, true),
+                                                           Q_ARG(QVariant, showMeta),
+                                                           Q_ARG(QVariant, appLauncher));
     };
 
-    auto invokeShowOnlyMeta = [this](const Plasma::Containment * c, const bool showLatteShortcuts) {
-        if (QQuickItem *containmentInterface = c->property("_plasma_graphicObject").value<QQuickItem *>()) {
-            const auto &childItems = containmentInterface->childItems();
-
-            for (QQuickItem *item : childItems) {
-                if (auto *metaObject = item->metaObject()) {
-                    // not using QMetaObject::invokeMethod to avoid warnings when calling
-                    // this on applets that don't have it or other child items since this
-                    // is pretty much trial and error.
-
-                    // Also, "var" arguments are treated as QVariant in QMetaObject
-                    int methodIndex = metaObject->indexOfMethod("setShowAppletShortcutBadges(QVariant,QVariant,QVariant,QVariant)");
-
-                    if (methodIndex == -1) {
-                        continue;
-                    }
-
-                    int appLauncher = m_corona->universalSettings()->metaForwardedToLatte() ?
-                                applicationLauncherId(c) : -1;
+    auto invokeShowShortcuts = [this, invokeShowShortcutBadges](const Plasma::Containment * c, const bool showLatteShortcuts, const bool showMeta) {
+        int appLauncher = m_corona->universalSettings()->metaForwardedToLatte() && showMeta ?
+                    applicationLauncherId(c) : -1;
 
-                    int showMethodIndex = -1;
+        return invokeShowShortcutBadges(c, showLatteShortcuts, showMeta, appLauncher);
+    };
 
-                    if (!m_viewItemsCalled.contains(item)) {
-                        m_viewItemsCalled.append(item);
-                        m_showShortcutBadgesMethods.append(metaObject->method(methodIndex));
-                        showMethodIndex = m_showShortcutBadgesMethods.count() - 1;
-                    } else {
-                        showMethodIndex = m_showShortcutBadgesMethods.indexOf(metaObject->method(methodIndex));
-                    }
+    auto invokeShowOnlyMeta = [this, invokeShowShortcutBadges](const Plasma::Containment * c, const bool showLatteShortcuts) {
+        int appLauncher = m_corona->universalSettings()->metaForwardedToLatte() ?
+                    applicationLauncherId(c) : -1;
 
-                    if (m_showShortcutBadgesMethods[showMethodIndex].invoke(item,
-                                                                            Q_ARG(QVariant, showLatteShortcuts),
-                                                                            Q_ARG(QVariant, true),
-                                                                            Q_ARG(QVariant, true),
-                                                                            Q_ARG(QVariant, appLauncher))) {
-                        return true;
-                    }
-                }
-            }
-        }
-
-        return false;
+        return invokeShowShortcutBadges(c, showLatteShortcuts, true, appLauncher);
     };
 
     QList<Latte::View *> sortedViews;
@@ -754,6 +629,18 @@ void GlobalShortcuts::showSettings()
     }
 }
 
+void GlobalShortcuts::hideViewsOnModifiersRelease()
+{
+    if (!m_hideViewsTimer.isActive() || !m_lastInvokedAction) {
+        return;
+    }
+
+    if (!m_modifierTracker->sequenceModifierPressed(m_lastInvokedAction->shortcut())) {
+        m_hideViewsTimer.stop();
+        hideViewsTimerSlot();
+    }
+}
+
 void GlobalShortcuts::hideViewsTimerSlot()
 {
     if (!m_lastInvokedAction || m_hideViews.count() == 0) {
@@ -66,6 +66,7 @@ signals:
 
 private slots:
     void hideViewsTimerSlot();
+    void hideViewsOnModifiersRelease();
 
 private:
     void init();
@@ -74,6 +74,11 @@ void ModifierTracker::init()
 }
 
 
+bool ModifierTracker::modifiersEventsAvailable() const
+{
+    return !m_modifierKeyInfo.knownKeys().isEmpty();
+}
+
 bool ModifierTracker::modifierIsTracked(Qt::Key key)
 {
     if (m_blockedModifiers.contains(key)) {
@@ -50,6 +50,10 @@ public:
     //! only <key> is pressed and no other modifier
     bool singleModifierPressed(Qt::Key key);
 
+    //! modifiers state is updated through window system events,
+    //! it is false when no keyboard state source is available
+    bool modifiersEventsAvailable() const;
+
     void blockModifierTracking(Qt::Key key);
     void unblockModifierTracking(Qt::Key key);
 
@@ -0,0 +1,174 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "statsservice.h"
+
+// local
+#include "lattecorona.h"
+#include "layoutmanager.h"
+#include "layout/layout.h"
+#include "view/positioner.h"
+#include "view/view.h"
+#include "view/windowstracker.h"
+#include "../liblatte2/statistics.h"
+
+// Qt
+#include <QQuickItem>
+
+// Plasma
+#include <Plasma/Applet>
+#include <Plasma/Containment>
+
+namespace Latte {
+
+//! the scene graph textures, the glyph caches etc. of a view are not accounted,
+//! only its window buffers and an average cost for each qml item
+const qint64 WINDOWBUFFERSCOUNT = 2;
+const qint64 BYTESPERQMLITEM = 400;
+
+StatsService::StatsService(Latte::Corona *corona)
+    : QObject(corona),
+      m_corona(corona)
+{
+}
+
+StatsService::~StatsService()
+{
+}
+
+QVariantMap StatsService::counters() const
+{
+    Statistics *statistics = Statistics::self();
+
+    QVariantMap counters;
+
+    for (int i = 0; i < Statistics::CountersCount; ++i) {
+        const Statistics::Counter counter = static_cast<Statistics::Counter>(i);
+        counters[Statistics::name(counter)] = statistics->value(counter);
+    }
+
+    const quint64 received = statistics->value(Statistics::WindowEventsReceived);
+    const quint64 delivered = statistics->value(Statistics::WindowEventsDelivered);
+    counters[QStringLiteral("windowEventsFiltered")] = received > delivered ? received - delivered : 0;
+
+    auto hitRate = [&statistics](Statistics::Counter hits, Statistics::Counter misses) {
+        const quint64 total = statistics->value(hits) + statistics->value(misses);
+        return total > 0 ? static_cast<double>(statistics->value(hits)) / total : 0.0;
+    };
+
+    counters[QStringLiteral("maskRegionsHitRate")] = hitRate(Statistics::MaskRegionsHits, Statistics::MaskRegionsMisses);
+    counters[QStringLiteral("iconColorsHitRate")] = hitRate(Statistics::IconColorsHits, Statistics::IconColorsMisses);
+    counters[QStringLiteral("backgroundHintsHitRate")] = hitRate(Statistics::BackgroundHintsHits, Statistics::BackgroundHintsMisses);
+
+    return counters;
+}
+
+QVariantMap StatsService::layouts() const
+{
+    QVariantMap layouts;
+    LayoutManager *manager = m_corona->layoutManager();
+
+    for (const auto &layoutName : manager->activeLayoutsNames()) {
+        Layout *layout = manager->activeLayout(layoutName);
+
+        if (!layout) {
+            continue;
+        }
+
+        int applets{0};
+        qint64 bytes{0};
+
+        for (const auto view : *layout->latteViews()) {
+            applets += view->containment() ? view->containment()->applets().count() : 0;
+            bytes += estimatedBytes(view, qmlItemsCount(view));
+        }
+
+        QVariantMap data;
+        data[QStringLiteral("views")] = layout->latteViews()->count();
+        data[QStringLiteral("applets")] = applets;
+        data[QStringLiteral("estimatedBytes")] = bytes;
+
+        layouts[layoutName] = data;
+    }
+
+    return layouts;
+}
+
+QVariantMap StatsService::views() const
+{
+    QVariantMap views;
+    LayoutManager *manager = m_corona->layoutManager();
+
+    for (const auto &layoutName : manager->activeLayoutsNames()) {
+        Layout *layout = manager->activeLayout(layoutName);
+
+        if (!layout) {
+            continue;
+        }
+
+        for (const auto view : *layout->latteViews()) {
+            if (!view->containment()) {
+                continue;
+            }
+
+            const int qmlItems = qmlItemsCount(view);
+
+            QVariantMap data;
+            data[QStringLiteral("screen")] = view->positioner()->currentScreenName();
+            data[QStringLiteral("location")] = static_cast<int>(view->location());
+            data[QStringLiteral("applets")] = view->containment()->applets().count();
+            data[QStringLiteral("updateFlagsRuns")] = view->windowsTracker() ? view->windowsTracker()->updateFlagsRuns() : 0;
+            data[QStringLiteral("qmlItems")] = qmlItems;
+            data[QStringLiteral("estimatedBytes")] = estimatedBytes(view, qmlItems);
+
+            views[layoutName + QLatin1Char('/') + QString::number(view->containment()->id())] = data;
+        }
+    }
+
+    return views;
+}
+
+int StatsService::qmlItemsCount(Latte::View *view) const
+{
+    int count{0};
+    QList<QQuickItem *> items;
+
+    if (view->rootObject()) {
+        items << view->rootObject();
+    }
+
+    while (!items.isEmpty()) {
+        QQuickItem *item = items.takeLast();
+        count++;
+        items << item->childItems();
+    }
+
+    return count;
+}
+
+qint64 StatsService::estimatedBytes(Latte::View *view, int qmlItems) const
+{
+    const qreal dpr = view->devicePixelRatio();
+    const qint64 buffers = static_cast<qint64>(view->width() * dpr) * static_cast<qint64>(view->height() * dpr) * 4 * WINDOWBUFFERSCOUNT;
+
+    return buffers + qmlItems * BYTESPERQMLITEM;
+}
+
+}
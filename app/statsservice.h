@@ -0,0 +1,67 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef STATSSERVICE_H
+#define STATSSERVICE_H
+
+// Qt
+#include <QObject>
+#include <QVariantMap>
+
+namespace Latte {
+class Corona;
+class View;
+}
+
+namespace Latte {
+
+//! It provides the read-only org.kde.LatteDock.Stats D-Bus interface with the
+//! live counters of the session, the hit rates of the caches and estimates of
+//! the memory that the layouts and their views are using. It is meant to be
+//! scraped periodically from monitoring tools, every call is cheap.
+class StatsService : public QObject
+{
+    Q_OBJECT
+    Q_CLASSINFO("D-Bus Interface", "org.kde.LatteDock.Stats")
+
+public:
+    StatsService(Latte::Corona *corona);
+    ~StatsService() override;
+
+public slots:
+    //! counter name -> value, together with the derived filtered events and hit rates
+    QVariantMap counters() const;
+    //! layout name -> {views, applets, estimatedBytes}
+    QVariantMap layouts() const;
+    //! "layout/containment id" -> {screen, location, updateFlagsRuns, qmlItems, estimatedBytes}
+    QVariantMap views() const;
+
+private:
+    //! it walks the whole qml tree of the view, it is counted once per view and call
+    int qmlItemsCount(Latte::View *view) const;
+    qint64 estimatedBytes(Latte::View *view, int qmlItems) const;
+
+private:
+    Latte::Corona *m_corona{nullptr};
+};
+
+}
+
+#endif
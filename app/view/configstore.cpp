@@ -0,0 +1,100 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "configstore.h"
+
+// local
+#include "view.h"
+#include "../../liblatte2/statistics.h"
+
+// Qt
+#include <QDebug>
+
+// Plasma
+#include <Plasma/Containment>
+
+namespace Latte {
+namespace ViewPart {
+
+ConfigStore::ConfigStore(Latte::View *view)
+    : QObject(view),
+      m_latteView(view)
+{
+    m_flushTimer.setSingleShot(true);
+    m_flushTimer.setInterval(1000);
+    connect(&m_flushTimer, &QTimer::timeout, this, &ConfigStore::flush);
+}
+
+ConfigStore::~ConfigStore()
+{
+    //! the view must flush before its containment is released
+    if (isDirty()) {
+        qWarning() << "ConfigStore, pending entries were lost ::: " << m_pending.keys();
+    }
+}
+
+KConfigGroup ConfigStore::config() const
+{
+    if (!m_latteView || !m_latteView->containment()) {
+        return KConfigGroup();
+    }
+
+    return m_latteView->containment()->config();
+}
+
+bool ConfigStore::isDirty() const
+{
+    return !m_pending.isEmpty();
+}
+
+void ConfigStore::writeEntry(const QString &key, const QVariant &value)
+{
+    if (!m_pending.contains(key) && m_stored.contains(key) && m_stored[key] == value) {
+        LATTE_COUNT(ConfigWritesSkipped);
+        return;
+    }
+
+    m_pending[key] = value;
+    m_flushTimer.start();
+}
+
+void ConfigStore::flush()
+{
+    m_flushTimer.stop();
+
+    if (m_pending.isEmpty() || !m_latteView || !m_latteView->containment()) {
+        return;
+    }
+
+    auto config = m_latteView->containment()->config();
+
+    for (auto it = m_pending.constBegin(); it != m_pending.constEnd(); ++it) {
+        config.writeEntry(it.key(), it.value());
+        LATTE_COUNT(ConfigWrites);
+        m_stored[it.key()] = it.value();
+    }
+
+    m_pending.clear();
+
+    m_latteView->containment()->configNeedsSaving();
+}
+
+}
+}
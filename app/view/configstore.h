@@ -0,0 +1,93 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef VIEWCONFIGSTORE_H
+#define VIEWCONFIGSTORE_H
+
+// Qt
+#include <QHash>
+#include <QObject>
+#include <QTimer>
+#include <QVariant>
+
+// KDE
+#include <KConfigGroup>
+
+namespace Latte {
+class View;
+}
+
+namespace Latte {
+namespace ViewPart {
+
+//! It buffers the view settings that are written in its containment config.
+//! The entries that are read through it are remembered, so writing a value that
+//! is already stored costs nothing, and the changed entries are written together
+//! once their burst of changes has settled, e.g. during startup or while the
+//! user is dragging a slider in the settings window
+class ConfigStore : public QObject
+{
+    Q_OBJECT
+
+public:
+    ConfigStore(Latte::View *view);
+    ~ConfigStore() override;
+
+    template <typename T>
+    T readEntry(const QString &key, const T &defaultValue);
+
+    void writeEntry(const QString &key, const QVariant &value);
+
+    bool isDirty() const;
+
+public slots:
+    //! write the pending entries immediately
+    void flush();
+
+private:
+    KConfigGroup config() const;
+
+private:
+    //! the entries that are known to be stored in the config
+    QHash<QString, QVariant> m_stored;
+    QHash<QString, QVariant> m_pending;
+
+    QTimer m_flushTimer;
+
+    Latte::View *m_latteView{nullptr};
+};
+
+template <typename T>
+T ConfigStore::readEntry(const QString &key, const T &defaultValue)
+{
+    if (m_pending.contains(key)) {
+        return m_pending[key].value<T>();
+    }
+
+    T value = config().readEntry(key, defaultValue);
+    m_stored[key] = QVariant::fromValue(value);
+
+    return value;
+}
+
+}
+}
+
+#endif
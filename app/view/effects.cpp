@@ -20,8 +20,12 @@
 #include "effects.h"
 
 // local
+#include "maskcache.h"
 #include "panelshadows_p.h"
 #include "view.h"
+#include "../lattecorona.h"
+#include "../../liblatte2/statistics.h"
+#include "../../liblatte2/tracer.h"
 #include "../../liblatte2/types.h"
 
 // Qt
@@ -62,6 +66,13 @@ void Effects::init()
     connect(m_view, &Latte::View::behaveAsPlasmaPanelChanged, this, &Effects::updateShadows);
 
     connect(this, SIGNAL(innerShadowChanged()), m_view->corona(), SIGNAL(availableScreenRectChanged()));
+
+    //! the window effects must be sent again when the platform window is recreated
+    connect(m_view, &Latte::View::eventTriggered, this, [&](QEvent *ev) {
+        if (ev->type() == QEvent::Show) {
+            m_effectsApplied = false;
+        }
+    });
 }
 
 bool Effects::animationsBlocked() const
@@ -185,9 +196,12 @@ QRect Effects::mask() const
 
 void Effects::setMask(QRect area)
 {
+    LATTE_TRACE_SCOPE("view", "Effects::setMask");
+
     if (m_mask == area)
         return;
 
+    LATTE_COUNT(MaskUpdates);
     m_mask = area;
 
     if (KWindowSystem::compositingActive()) {
@@ -200,19 +214,10 @@ void Effects::setMask(QRect area)
         //! this is used when compositing is disabled and provides
         //! the correct way for the mask to be painted in order for
         //! rounded corners to be shown correctly
-        //! the enabledBorders check was added because there was cases
-        //! that the mask region wasn't calculated correctly after location changes
-        if (!m_background || m_background->enabledBorders() != m_enabledBorders) {
-            m_background = new Plasma::FrameSvg(this);
-        }
-
-        if (m_background->imagePath() != "opaque/dialogs/background") {
-            m_background->setImagePath(QStringLiteral("opaque/dialogs/background"));
-        }
-
-        m_background->setEnabledBorders(m_enabledBorders);
-        m_background->resizeFrame(area.size());
-        QRegion fixedMask = m_background->mask();
+        //! the regions are cached for all views based on borders, size and dpr
+        auto latteCorona = qobject_cast<Latte::Corona *>(m_view->corona());
+        QRegion fixedMask = latteCorona->maskCache()->mask(QStringLiteral("opaque/dialogs/background"), m_enabledBorders,
+                            area.size(), m_view->devicePixelRatio());
         fixedMask.translate(m_mask.x(), m_mask.y());
 
         //! fix for KF5.32 that return empty QRegion's for the mask
@@ -220,7 +225,9 @@ void Effects::setMask(QRect area)
             fixedMask = QRegion(m_mask);
         }
 
-        m_view->setMask(fixedMask);
+        if (m_view->mask() != fixedMask) {
+            m_view->setMask(fixedMask);
+        }
     }
 
     // qDebug() << "dock mask set:" << m_mask;
@@ -251,20 +258,11 @@ void Effects::updateEffects()
 
     if (!m_view->behaveAsPlasmaPanel()) {
         if (m_drawEffects && !m_rect.isNull() && !m_rect.isEmpty()) {
-            //! this is used when compositing is disabled and provides
-            //! the correct way for the mask to be painted in order for
-            //! rounded corners to be shown correctly
-            if (!m_background) {
-                m_background = new Plasma::FrameSvg(this);
-            }
-
-            if (m_background->imagePath() != "widgets/panel-background") {
-                m_background->setImagePath(QStringLiteral("widgets/panel-background"));
-            }
-
-            m_background->setEnabledBorders(m_enabledBorders);
-            m_background->resizeFrame(m_rect.size());
-            QRegion fixedMask = m_background->mask();
+            //! this provides the correct way for the blur region to be painted
+            //! in order for rounded corners to be shown correctly
+            auto latteCorona = qobject_cast<Latte::Corona *>(m_view->corona());
+            QRegion fixedMask = latteCorona->maskCache()->mask(QStringLiteral("widgets/panel-background"), m_enabledBorders,
+                                m_rect.size(), m_view->devicePixelRatio());
             fixedMask.translate(m_rect.x(), m_rect.y());
 
             //! fix1, for KF5.32 that return empty QRegion's for the mask
@@ -272,34 +270,57 @@ void Effects::updateEffects()
                 fixedMask = QRegion(m_rect);
             }
 
-            KWindowEffects::enableBlurBehind(m_view->winId(), true, fixedMask);
-
             bool drawBackgroundEffect = m_theme.backgroundContrastEnabled() && (m_backgroundOpacity == 100);
             //based on Breeze Dark theme behavior the enableBackgroundContrast even though it does accept
             //a QRegion it uses only the first rect. The bug was that for Breeze Dark there was a line
             //at the dock bottom that was distinguishing it from other themes
-            KWindowEffects::enableBackgroundContrast(m_view->winId(), drawBackgroundEffect,
-                    m_theme.backgroundContrast(),
-                    m_theme.backgroundIntensity(),
-                    m_theme.backgroundSaturation(),
-                    fixedMask.boundingRect());
+            applyEffects(true, fixedMask, drawBackgroundEffect, fixedMask.boundingRect());
         } else {
-            KWindowEffects::enableBlurBehind(m_view->winId(), false);
-            KWindowEffects::enableBackgroundContrast(m_view->winId(), false);
+            applyEffects(false, QRegion(), false, QRegion());
         }
     } else if (m_view->behaveAsPlasmaPanel() && m_drawEffects) {
-        KWindowEffects::enableBlurBehind(m_view->winId(), true);
-
         bool drawBackgroundEffect = m_theme.backgroundContrastEnabled() && (m_backgroundOpacity == 100);
 
-        KWindowEffects::enableBackgroundContrast(m_view->winId(), drawBackgroundEffect,
-                m_theme.backgroundContrast(),
-                m_theme.backgroundIntensity(),
-                m_theme.backgroundSaturation());
+        applyEffects(true, QRegion(), drawBackgroundEffect, QRegion());
     } else {
-        KWindowEffects::enableBlurBehind(m_view->winId(), false);
-        KWindowEffects::enableBackgroundContrast(m_view->winId(), false);
+        applyEffects(false, QRegion(), false, QRegion());
+    }
+}
+
+void Effects::applyEffects(bool blur, const QRegion &blurRegion, bool contrast, const QRegion &contrastRegion)
+{
+    //! identical regions are not sent again to the window system, this
+    //! happens continuously during animations that do not change the background
+    bool blurChanged = !m_effectsApplied || m_blurEnabled != blur || m_blurRegion != blurRegion;
+    bool contrastChanged = !m_effectsApplied || m_contrastEnabled != contrast || m_contrastRegion != contrastRegion
+                           || m_contrast != m_theme.backgroundContrast()
+                           || m_intensity != m_theme.backgroundIntensity()
+                           || m_saturation != m_theme.backgroundSaturation();
+
+    if (blurChanged) {
+        KWindowEffects::enableBlurBehind(m_view->winId(), blur, blurRegion);
+    }
+
+    if (contrastChanged) {
+        if (contrast) {
+            KWindowEffects::enableBackgroundContrast(m_view->winId(), true,
+                    m_theme.backgroundContrast(),
+                    m_theme.backgroundIntensity(),
+                    m_theme.backgroundSaturation(),
+                    contrastRegion);
+        } else {
+            KWindowEffects::enableBackgroundContrast(m_view->winId(), false);
+        }
     }
+
+    m_effectsApplied = true;
+    m_blurEnabled = blur;
+    m_blurRegion = blurRegion;
+    m_contrastEnabled = contrast;
+    m_contrastRegion = contrastRegion;
+    m_contrast = m_theme.backgroundContrast();
+    m_intensity = m_theme.backgroundIntensity();
+    m_saturation = m_theme.backgroundSaturation();
 }
 
 //!BEGIN draw panel shadows outside the dock window
@@ -24,6 +24,7 @@
 #include <QObject>
 #include <QPointer>
 #include <QRect>
+#include <QRegion>
 
 // Plasma
 #include <Plasma/FrameSvg>
@@ -101,6 +102,9 @@ signals:
 private slots:
     void init();
 
+private:
+    void applyEffects(bool blur, const QRegion &blurRegion, bool contrast, const QRegion &contrastRegion);
+
 private:
     bool m_animationsBlocked{false};
     bool m_drawShadows{true};
@@ -116,8 +120,16 @@ private:
     QPointer<Latte::View> m_view;
 
     Plasma::Theme m_theme;
-    //only for the mask on disabled compositing, not to actually paint
-    Plasma::FrameSvg *m_background{nullptr};
+
+    //! last effects sent to the window system
+    bool m_effectsApplied{false};
+    bool m_blurEnabled{false};
+    bool m_contrastEnabled{false};
+    QRegion m_blurRegion;
+    QRegion m_contrastRegion;
+    qreal m_contrast{0};
+    qreal m_intensity{0};
+    qreal m_saturation{0};
 
     //only for the mask, not to actually paint
     Plasma::FrameSvg::EnabledBorders m_enabledBorders{Plasma::FrameSvg::AllBorders};
@@ -0,0 +1,298 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "framestatistics.h"
+
+// local
+#include "positioner.h"
+#include "view.h"
+
+// Qt
+#include <QDebug>
+#include <QMutexLocker>
+#include <QScreen>
+
+namespace Latte {
+namespace ViewPart {
+
+//! a frame that was requested that many refresh intervals after the previous
+//! swap follows an idle period, e.g. a hovered but still parabolic zoom
+const int IDLEREFRESHES = 6;
+
+FrameStatistics::FrameStatistics(Latte::View *view)
+    : QObject(view),
+      m_latteView(view)
+{
+    m_summaryTimer.setInterval(1000);
+    connect(&m_summaryTimer, &QTimer::timeout, this, &FrameStatistics::updateSummary);
+
+    connect(m_latteView, &QWindow::screenChanged, this, &FrameStatistics::updateRefreshRate);
+
+    m_clock.start();
+    updateRefreshRate();
+    updateSummary();
+}
+
+FrameStatistics::~FrameStatistics()
+{
+    disconnect(m_frameSwappedConnection);
+    disconnect(m_afterAnimatingConnection);
+
+    //! a frame that the render thread is measuring right now must finish
+    //! before the members are destroyed
+    QMutexLocker locker(&m_mutex);
+}
+
+bool FrameStatistics::enabled() const
+{
+    return m_enabled;
+}
+
+void FrameStatistics::setEnabled(bool enabled)
+{
+    if (m_enabled == enabled) {
+        return;
+    }
+
+    m_enabled = enabled;
+
+    Positioner *positioner = m_latteView->positioner();
+
+    if (m_enabled) {
+        //! the render thread delivers the frames, they are measured right there
+        m_frameSwappedConnection = connect(m_latteView, &QQuickWindow::frameSwapped
+                                           , this, &FrameStatistics::frameSwapped, Qt::DirectConnection);
+        //! the gui thread prepares every frame that was requested right after
+        //! advancing its animations
+        m_afterAnimatingConnection = connect(m_latteView, &QQuickWindow::afterAnimating
+                                             , this, &FrameStatistics::frameRequested);
+
+        if (positioner) {
+            for (auto started : {&Positioner::hideDockDuringLocationChangeStarted
+                                 , &Positioner::hideDockDuringScreenChangeStarted
+                                 , &Positioner::hideDockDuringMovingToLayoutStarted}) {
+                connect(positioner, started, this, [&]() {
+                    setRelocating(true);
+                });
+            }
+
+            for (auto finished : {&Positioner::showDockAfterLocationChangeFinished
+                                  , &Positioner::showDockAfterScreenChangeFinished
+                                  , &Positioner::showDockAfterMovingToLayoutFinished}) {
+                connect(positioner, finished, this, [&]() {
+                    setRelocating(false);
+                });
+            }
+
+            setRelocating(positioner->inLocationChangeAnimation());
+        }
+
+        m_summaryTimer.start();
+    } else {
+        disconnect(m_frameSwappedConnection);
+        disconnect(m_afterAnimatingConnection);
+
+        if (positioner) {
+            disconnect(positioner, nullptr, this, nullptr);
+        }
+
+        setRelocating(false);
+        m_summaryTimer.stop();
+        updateSummary();
+    }
+
+    emit enabledChanged();
+}
+
+bool FrameStatistics::zooming() const
+{
+    return m_animations & (1 << Zoom);
+}
+
+void FrameStatistics::setZooming(bool zooming)
+{
+    if (this->zooming() == zooming) {
+        return;
+    }
+
+    setAnimation(Zoom, zooming);
+    emit zoomingChanged();
+}
+
+bool FrameStatistics::sliding() const
+{
+    return m_animations & (1 << Slide);
+}
+
+void FrameStatistics::setSliding(bool sliding)
+{
+    if (this->sliding() == sliding) {
+        return;
+    }
+
+    setAnimation(Slide, sliding);
+    emit slidingChanged();
+}
+
+bool FrameStatistics::relocating() const
+{
+    return m_animations & (1 << Relocation);
+}
+
+void FrameStatistics::setRelocating(bool relocating)
+{
+    if (this->relocating() == relocating) {
+        return;
+    }
+
+    setAnimation(Relocation, relocating);
+    emit relocatingChanged();
+}
+
+void FrameStatistics::setAnimation(Animation animation, bool active)
+{
+    if (active) {
+        m_animations |= (1 << animation);
+    } else {
+        m_animations &= ~(1 << animation);
+    }
+}
+
+QString FrameStatistics::summary() const
+{
+    return m_summary;
+}
+
+void FrameStatistics::reset()
+{
+    QMutexLocker locker(&m_mutex);
+
+    m_histograms.fill(Histogram());
+    m_lastSwapNsecs = -1;
+
+    locker.unlock();
+
+    updateSummary();
+}
+
+void FrameStatistics::updateRefreshRate()
+{
+    QScreen *screen = m_latteView->screen();
+    const qreal rate = screen && screen->refreshRate() > 1 ? screen->refreshRate() : 60;
+
+    m_refreshNsecs = static_cast<qint64>(1000000000 / rate);
+}
+
+int FrameStatistics::bucket(qint64 nsecs) const
+{
+    static const std::array<qint64, BucketsCount - 1> limits{{8, 17, 25, 33, 50, 100}};
+
+    for (int i = 0; i < BucketsCount - 1; ++i) {
+        if (nsecs < limits[i] * 1000000) {
+            return i;
+        }
+    }
+
+    return BucketsCount - 1;
+}
+
+void FrameStatistics::frameRequested()
+{
+    m_requestNsecs = m_clock.nsecsElapsed();
+}
+
+void FrameStatistics::frameSwapped()
+{
+    QMutexLocker locker(&m_mutex);
+
+    const int animations = m_animations;
+    const qint64 now = m_clock.nsecsElapsed();
+    const qint64 refreshNsecs = m_refreshNsecs;
+
+    //! the first frame of an animation has no previous frame to be compared with
+    //! and a frame that was requested long after the previous swap ends an idle
+    //! period, the time that nothing needed to be painted is not a dropped frame.
+    //! A frame that was requested in time but rendered late is always measured.
+    const bool idle = m_lastSwapNsecs >= 0 && (m_requestNsecs - m_lastSwapNsecs) > IDLEREFRESHES * refreshNsecs;
+
+    if (animations == 0 || m_lastSwapNsecs < 0 || idle) {
+        m_lastSwapNsecs = animations == 0 ? -1 : now;
+        return;
+    }
+
+    const qint64 frameNsecs = now - m_lastSwapNsecs;
+    m_lastSwapNsecs = now;
+
+    //! a frame that took e.g. 2.4 refresh intervals means that 1 frame was dropped
+    const int dropped = qMax(0, static_cast<int>((frameNsecs + refreshNsecs / 2) / refreshNsecs) - 1);
+    const int frameBucket = bucket(frameNsecs);
+
+    for (int i = 0; i < AnimationsCount; ++i) {
+        if (!(animations & (1 << i))) {
+            continue;
+        }
+
+        Histogram &histogram = m_histograms[i];
+        histogram.buckets[frameBucket]++;
+        histogram.frames++;
+        histogram.dropped += dropped;
+        histogram.totalNsecs += frameNsecs;
+        histogram.maxNsecs = qMax(histogram.maxNsecs, frameNsecs);
+    }
+}
+
+void FrameStatistics::updateSummary()
+{
+    static const std::array<QString, AnimationsCount> names{{QStringLiteral("zoom"), QStringLiteral("slide"), QStringLiteral("relocation")}};
+
+    QStringList lines;
+
+    QMutexLocker locker(&m_mutex);
+
+    for (int i = 0; i < AnimationsCount; ++i) {
+        const Histogram &histogram = m_histograms[i];
+
+        QStringList buckets;
+
+        for (const int count : histogram.buckets) {
+            buckets << QString::number(count);
+        }
+
+        lines << QStringLiteral("%1: frames %2, dropped %3, mean %4ms, max %5ms, histogram [%6]")
+              .arg(names[i])
+              .arg(histogram.frames)
+              .arg(histogram.dropped)
+              .arg(histogram.frames > 0 ? histogram.totalNsecs / 1000000.0 / histogram.frames : 0, 0, 'f', 1)
+              .arg(histogram.maxNsecs / 1000000.0, 0, 'f', 1)
+              .arg(buckets.join(QStringLiteral(" ")));
+    }
+
+    locker.unlock();
+
+    const QString summary = lines.join(QStringLiteral("\n"));
+
+    if (m_summary != summary) {
+        m_summary = summary;
+        emit summaryChanged();
+    }
+}
+
+}
+}
@@ -0,0 +1,142 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef VIEWFRAMESTATISTICS_H
+#define VIEWFRAMESTATISTICS_H
+
+// C++
+#include <array>
+#include <atomic>
+
+// Qt
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QObject>
+#include <QTimer>
+
+namespace Latte {
+class View;
+}
+
+namespace Latte {
+namespace ViewPart {
+
+//! It measures the time between the frames that the view presents during its
+//! parabolic zoom, its slide in/out and its location change animations and keeps
+//! a histogram of the frame durations and the dropped frames for each of them.
+//! Frames are only measured while it is enabled, the animation states are
+//! provided from the containment qml side except the location changes.
+class FrameStatistics : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(bool enabled READ enabled WRITE setEnabled NOTIFY enabledChanged)
+    Q_PROPERTY(bool zooming READ zooming WRITE setZooming NOTIFY zoomingChanged)
+    Q_PROPERTY(bool sliding READ sliding WRITE setSliding NOTIFY slidingChanged)
+    Q_PROPERTY(bool relocating READ relocating NOTIFY relocatingChanged)
+
+    Q_PROPERTY(QString summary READ summary NOTIFY summaryChanged)
+
+public:
+    enum Animation
+    {
+        Zoom = 0,
+        Slide,
+        Relocation,
+        AnimationsCount
+    };
+
+    FrameStatistics(Latte::View *view);
+    ~FrameStatistics() override;
+
+    bool enabled() const;
+    void setEnabled(bool enabled);
+
+    bool zooming() const;
+    void setZooming(bool zooming);
+
+    bool sliding() const;
+    void setSliding(bool sliding);
+
+    bool relocating() const;
+
+    QString summary() const;
+
+public slots:
+    Q_INVOKABLE void reset();
+
+signals:
+    void enabledChanged();
+    void relocatingChanged();
+    void slidingChanged();
+    void summaryChanged();
+    void zoomingChanged();
+
+private slots:
+    void frameRequested();
+    void frameSwapped();
+    void updateRefreshRate();
+    void updateSummary();
+
+private:
+    //! frame durations up to 8, 17, 25, 33, 50, 100 and above 100ms
+    static const int BucketsCount = 7;
+
+    struct Histogram {
+        std::array<int, BucketsCount> buckets{{0, 0, 0, 0, 0, 0, 0}};
+        int frames{0};
+        int dropped{0};
+        qint64 totalNsecs{0};
+        qint64 maxNsecs{0};
+    };
+
+    void setAnimation(Animation animation, bool active);
+    void setRelocating(bool relocating);
+
+    int bucket(qint64 nsecs) const;
+
+private:
+    bool m_enabled{false};
+
+    //! the animations that are currently running, one bit per Animation
+    std::atomic<int> m_animations{0};
+    std::atomic<qint64> m_refreshNsecs{16666667};
+    //! when the gui thread prepared the last requested frame
+    std::atomic<qint64> m_requestNsecs{-1};
+
+    //! accessed from the render thread
+    qint64 m_lastSwapNsecs{-1};
+    std::array<Histogram, AnimationsCount> m_histograms;
+    mutable QMutex m_mutex;
+
+    QString m_summary;
+
+    QElapsedTimer m_clock;
+    QTimer m_summaryTimer;
+
+    QMetaObject::Connection m_afterAnimatingConnection;
+    QMetaObject::Connection m_frameSwappedConnection;
+
+    Latte::View *m_latteView{nullptr};
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,88 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "maskcache.h"
+
+// local
+#include "../../liblatte2/statistics.h"
+
+// Qt
+#include <QDebug>
+
+#define MAXCACHEDREGIONS 128
+
+namespace Latte {
+namespace ViewPart {
+
+MaskCache::MaskCache(QObject *parent)
+    : QObject(parent)
+{
+    m_regions.setMaxCost(MAXCACHEDREGIONS);
+
+    connect(&m_theme, &Plasma::Theme::themeChanged, this, &MaskCache::clear);
+}
+
+MaskCache::~MaskCache()
+{
+    m_regions.clear();
+    m_frames.clear();
+}
+
+void MaskCache::clear()
+{
+    m_regions.clear();
+}
+
+Plasma::FrameSvg *MaskCache::frame(const QString &imagePath)
+{
+    if (!m_frames.contains(imagePath)) {
+        Plasma::FrameSvg *background = new Plasma::FrameSvg(this);
+        background->setImagePath(imagePath);
+        m_frames[imagePath] = background;
+    }
+
+    return m_frames[imagePath];
+}
+
+QRegion MaskCache::mask(const QString &imagePath, Plasma::FrameSvg::EnabledBorders borders, const QSize &size, qreal devicePixelRatio)
+{
+    const QString key = imagePath + QLatin1Char('_') + QString::number(static_cast<int>(borders))
+                        + QLatin1Char('_') + QString::number(size.width()) + QLatin1Char('x') + QString::number(size.height())
+                        + QLatin1Char('_') + QString::number(devicePixelRatio);
+
+    if (QRegion *cached = m_regions.object(key)) {
+        LATTE_COUNT(MaskRegionsHits);
+        return *cached;
+    }
+
+    LATTE_COUNT(MaskRegionsMisses);
+
+    Plasma::FrameSvg *background = frame(imagePath);
+    background->setDevicePixelRatio(devicePixelRatio);
+    background->setEnabledBorders(borders);
+    background->resizeFrame(size);
+
+    QRegion *region = new QRegion(background->mask());
+    m_regions.insert(key, region);
+
+    return *region;
+}
+
+}
+}
@@ -0,0 +1,68 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef MASKCACHE_H
+#define MASKCACHE_H
+
+// Qt
+#include <QCache>
+#include <QHash>
+#include <QObject>
+#include <QRegion>
+#include <QSize>
+
+// Plasma
+#include <Plasma/FrameSvg>
+#include <Plasma/Theme>
+
+namespace Latte {
+namespace ViewPart {
+
+//! It is owned by Corona, shared between all views and keeps the most recently used mask
+//! regions that are calculated from plasma theme frames. During parabolic
+//! zoom and show/hide animations the same regions are requested continuously,
+//! recalculating them from the svg for every frame is too costly
+class MaskCache : public QObject
+{
+    Q_OBJECT
+
+public:
+    MaskCache(QObject *parent = nullptr);
+    ~MaskCache() override;
+
+    //! the returned region is in frame coordinates, (0,0) is its top left corner
+    QRegion mask(const QString &imagePath, Plasma::FrameSvg::EnabledBorders borders, const QSize &size, qreal devicePixelRatio);
+
+public slots:
+    void clear();
+
+private:
+    Plasma::FrameSvg *frame(const QString &imagePath);
+
+private:
+    QCache<QString, QRegion> m_regions;
+    QHash<QString, Plasma::FrameSvg *> m_frames;
+
+    Plasma::Theme m_theme;
+};
+
+}
+}
+
+#endif
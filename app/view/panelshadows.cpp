@@ -68,6 +68,7 @@ public:
     void clearPixmaps();
     void setupPixmaps();
     Qt::HANDLE createPixmap(const QPixmap &source);
+    Qt::HANDLE x11Pixmap(const QPixmap &source);
     void initPixmap(const QString &element);
     QPixmap initEmptyPixmap(const QSize &size);
     void updateShadow(const QWindow *window, Plasma::FrameSvg::EnabledBorders);
@@ -100,6 +101,9 @@ public:
     //! graphical context
     xcb_gcontext_t _gc;
     bool m_isX11;
+
+    //! X11 pixmaps that have already been uploaded, keyed by QPixmap::cacheKey()
+    QHash<qint64, Qt::HANDLE> m_x11Pixmaps;
 #endif
 
     struct Wayland
@@ -166,9 +170,9 @@ void PanelShadows::removeWindow(const QWindow *window)
     disconnect(window, nullptr, this, nullptr);
     d->clearShadow(window);
 
-    if (d->m_windows.isEmpty()) {
-        d->clearPixmaps();
-    }
+    //! the shadow pixmaps are not released when the last window is removed,
+    //! panels toggle their shadows often and they would be uploaded again
+    //! to the window system. They are released only when the theme changes
 }
 
 void PanelShadows::setEnabledBorders(const QWindow *window, Plasma::FrameSvg::EnabledBorders enabledBorders)
@@ -185,10 +189,6 @@ void PanelShadows::setEnabledBorders(const QWindow *window, Plasma::FrameSvg::En
 void PanelShadows::Private::windowDestroyed(QObject *deletedObject)
 {
     m_windows.remove(static_cast<QWindow *>(deletedObject));
-
-    if (m_windows.isEmpty()) {
-        clearPixmaps();
-    }
 }
 
 void PanelShadows::Private::updateShadows()
@@ -261,6 +261,27 @@ Qt::HANDLE PanelShadows::Private::createPixmap(const QPixmap &source)
 
 }
 
+Qt::HANDLE PanelShadows::Private::x11Pixmap(const QPixmap &source)
+{
+#if HAVE_X11
+
+    if (source.isNull() || !m_isX11) {
+        return nullptr;
+    }
+
+    //! each tile is uploaded only once and its handle is shared between
+    //! all windows and enabled borders combinations
+    if (!m_x11Pixmaps.contains(source.cacheKey())) {
+        m_x11Pixmaps[source.cacheKey()] = createPixmap(source);
+    }
+
+    return m_x11Pixmaps.value(source.cacheKey());
+#else
+    Q_UNUSED(source)
+    return nullptr;
+#endif
+}
+
 void PanelShadows::Private::initPixmap(const QString &element)
 {
     m_shadowPixmaps << q->pixmap(element);
@@ -325,78 +346,78 @@ void PanelShadows::Private::setupData(Plasma::FrameSvg::EnabledBorders enabledBo
 
     //shadow-top
     if (enabledBorders & Plasma::FrameSvg::TopBorder) {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_shadowPixmaps[0]));
+        data[enabledBorders] << reinterpret_cast<unsigned long>(x11Pixmap(m_shadowPixmaps[0]));
     } else {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_emptyHorizontalPix));
+        data[enabledBorders] << reinterpret_cast<unsigned long>(x11Pixmap(m_emptyHorizontalPix));
     }
 
     //shadow-topright
     if (enabledBorders & Plasma::FrameSvg::TopBorder &&
         enabledBorders & Plasma::FrameSvg::RightBorder) {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_shadowPixmaps[1]));
+        data[enabledBorders] << reinterpret_cast<unsigned long>(x11Pixmap(m_shadowPixmaps[1]));
     } else if (enabledBorders & Plasma::FrameSvg::TopBorder) {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerTopPix));
+        data[enabledBorders] << reinterpret_cast<unsigned long>(x11Pixmap(m_emptyCornerTopPix));
     } else if (enabledBorders & Plasma::FrameSvg::RightBorder) {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerRightPix));
+        data[enabledBorders] << reinterpret_cast<unsigned long>(x11Pixmap(m_emptyCornerRightPix));
     } else {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerPix));
+        data[enabledBorders] << reinterpret_cast<unsigned long>(x11Pixmap(m_emptyCornerPix));
     }
 
     //shadow-right
     if (enabledBorders & Plasma::FrameSvg::RightBorder) {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_shadowPixmaps[2]));
+        data[enabledBorders] << reinterpret_cast<unsigned long>(x11Pixmap(m_shadowPixmaps[2]));
     } else {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_emptyVerticalPix));
+        data[enabledBorders] << reinterpret_cast<unsigned long>(x11Pixmap(m_emptyVerticalPix));
     }
 
     //shadow-bottomright
     if (enabledBorders & Plasma::FrameSvg::BottomBorder &&
         enabledBorders & Plasma::FrameSvg::RightBorder) {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_shadowPixmaps[3]));
+        data[enabledBorders] << reinterpret_cast<unsigned long>(x11Pixmap(m_shadowPixmaps[3]));
     } else if (enabledBorders & Plasma::FrameSvg::BottomBorder) {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerBottomPix));
+        data[enabledBorders] << reinterpret_cast<unsigned long>(x11Pixmap(m_emptyCornerBottomPix));
     } else if (enabledBorders & Plasma::FrameSvg::RightBorder) {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerRightPix));
+        data[enabledBorders] << reinterpret_cast<unsigned long>(x11Pixmap(m_emptyCornerRightPix));
     } else {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerPix));
+        data[enabledBorders] << reinterpret_cast<unsigned long>(x11Pixmap(m_emptyCornerPix));
     }
 
     //shadow-bottom
     if (enabledBorders & Plasma::FrameSvg::BottomBorder) {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_shadowPixmaps[4]));
+        data[enabledBorders] << reinterpret_cast<unsigned long>(x11Pixmap(m_shadowPixmaps[4]));
     } else {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_emptyHorizontalPix));
+        data[enabledBorders] << reinterpret_cast<unsigned long>(x11Pixmap(m_emptyHorizontalPix));
     }
 
     //shadow-bottomleft
     if (enabledBorders & Plasma::FrameSvg::BottomBorder &&
         enabledBorders & Plasma::FrameSvg::LeftBorder) {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_shadowPixmaps[5]));
+        data[enabledBorders] << reinterpret_cast<unsigned long>(x11Pixmap(m_shadowPixmaps[5]));
     } else if (enabledBorders & Plasma::FrameSvg::BottomBorder) {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerBottomPix));
+        data[enabledBorders] << reinterpret_cast<unsigned long>(x11Pixmap(m_emptyCornerBottomPix));
     } else if (enabledBorders & Plasma::FrameSvg::LeftBorder) {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerLeftPix));
+        data[enabledBorders] << reinterpret_cast<unsigned long>(x11Pixmap(m_emptyCornerLeftPix));
     } else {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerPix));
+        data[enabledBorders] << reinterpret_cast<unsigned long>(x11Pixmap(m_emptyCornerPix));
     }
 
     //shadow-left
     if (enabledBorders & Plasma::FrameSvg::LeftBorder) {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_shadowPixmaps[6]));
+        data[enabledBorders] << reinterpret_cast<unsigned long>(x11Pixmap(m_shadowPixmaps[6]));
     } else {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_emptyVerticalPix));
+        data[enabledBorders] << reinterpret_cast<unsigned long>(x11Pixmap(m_emptyVerticalPix));
     }
 
     //shadow-topleft
     if (enabledBorders & Plasma::FrameSvg::TopBorder &&
         enabledBorders & Plasma::FrameSvg::LeftBorder) {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_shadowPixmaps[7]));
+        data[enabledBorders] << reinterpret_cast<unsigned long>(x11Pixmap(m_shadowPixmaps[7]));
     } else if (enabledBorders & Plasma::FrameSvg::TopBorder) {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerTopPix));
+        data[enabledBorders] << reinterpret_cast<unsigned long>(x11Pixmap(m_emptyCornerTopPix));
     } else if (enabledBorders & Plasma::FrameSvg::LeftBorder) {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerLeftPix));
+        data[enabledBorders] << reinterpret_cast<unsigned long>(x11Pixmap(m_emptyCornerLeftPix));
     } else {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerPix));
+        data[enabledBorders] << reinterpret_cast<unsigned long>(x11Pixmap(m_emptyCornerPix));
     }
 
 #endif
@@ -470,40 +491,13 @@ void PanelShadows::Private::freeX11Pixmaps()
         return;
     }
 
-    foreach (const QPixmap &pixmap, m_shadowPixmaps) {
-        if (!pixmap.isNull()) {
-            XFreePixmap(display, reinterpret_cast<unsigned long>(createPixmap(pixmap)));
+    foreach (const Qt::HANDLE &handle, m_x11Pixmaps) {
+        if (handle) {
+            XFreePixmap(display, reinterpret_cast<unsigned long>(handle));
         }
     }
 
-    if (!m_emptyCornerPix.isNull()) {
-        XFreePixmap(display, reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerPix)));
-    }
-
-    if (!m_emptyCornerBottomPix.isNull()) {
-        XFreePixmap(display, reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerBottomPix)));
-    }
-
-    if (!m_emptyCornerLeftPix.isNull()) {
-        XFreePixmap(display, reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerLeftPix)));
-    }
-
-    if (!m_emptyCornerRightPix.isNull()) {
-        XFreePixmap(display, reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerRightPix)));
-    }
-
-    if (!m_emptyCornerTopPix.isNull()) {
-        XFreePixmap(display, reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerTopPix)));
-    }
-
-    if (!m_emptyVerticalPix.isNull()) {
-        XFreePixmap(display, reinterpret_cast<unsigned long>(createPixmap(m_emptyVerticalPix)));
-    }
-
-    if (!m_emptyHorizontalPix.isNull()) {
-        XFreePixmap(display, reinterpret_cast<unsigned long>(createPixmap(m_emptyHorizontalPix)));
-    }
-
+    m_x11Pixmaps.clear();
 #endif
 }
 
@@ -24,7 +24,8 @@
 #include "view.h"
 #include "../lattecorona.h"
 #include "../screenpool.h"
-#include "../settings/universalsettings.h"
+#include "../screentopology.h"
+#include "../../liblatte2/tracer.h"
 #include "../../liblatte2/types.h"
 
 // Qt
@@ -42,9 +43,11 @@ Positioner::Positioner(Latte::View *parent)
     : QObject(parent),
       m_view(parent)
 {
-    m_screenSyncTimer.setSingleShot(true);
-    m_screenSyncTimer.setInterval(2000);
-    connect(&m_screenSyncTimer, &QTimer::timeout, this, &Positioner::reconsiderScreen);
+    //! the screen of the view is reconsidered only after events that can move it,
+    //! events that arrive together are compressed into one reconsideration
+    m_reconsiderScreenTimer.setSingleShot(true);
+    m_reconsiderScreenTimer.setInterval(0);
+    connect(&m_reconsiderScreenTimer, &QTimer::timeout, this, &Positioner::reconsiderScreen);
 
     //! under X11 it was identified that windows many times especially under screen changes
     //! don't end up at the correct position and size. This timer will enforce repositionings
@@ -54,19 +57,21 @@ Positioner::Positioner(Latte::View *parent)
     m_validateGeometryTimer.setInterval(500);
     connect(&m_validateGeometryTimer, &QTimer::timeout, this, &Positioner::syncGeometry);
 
+    //! changes in location, alignment, thickness etc. arrive usually in bursts,
+    //! this timer compresses them in order to commit the window geometry only
+    //! once after all of them have been applied
+    m_syncGeometryTimer.setSingleShot(true);
+    m_syncGeometryTimer.setInterval(0);
+    connect(&m_syncGeometryTimer, &QTimer::timeout, this, &Positioner::syncGeometry);
+
     auto *latteCorona = qobject_cast<Latte::Corona *>(m_view->corona());
 
     if (latteCorona) {
-        m_screenSyncTimer.setInterval(qMax(latteCorona->universalSettings()->screenTrackerInterval() - 500, 1000));
-        connect(latteCorona->universalSettings(), &UniversalSettings::screenTrackerIntervalChanged, this, [this, latteCorona]() {
-            m_screenSyncTimer.setInterval(qMax(latteCorona->universalSettings()->screenTrackerInterval() - 500, 1000));
-        });
-
         connect(latteCorona, &Latte::Corona::viewLocationChanged, this, [&]() {
             //! check if an edge has been freed for a primary dock
             //! from another screen
             if (m_view->onPrimary()) {
-                m_screenSyncTimer.start();
+                scheduleReconsiderScreen();
             }
         });
     }
@@ -78,14 +83,15 @@ Positioner::~Positioner()
 {
     m_inDelete = true;
 
-    m_screenSyncTimer.stop();
+    m_reconsiderScreenTimer.stop();
+    m_syncGeometryTimer.stop();
     m_validateGeometryTimer.stop();
 }
 
 void Positioner::init()
 {
     //! connections
-    connect(this, &Positioner::screenGeometryChanged, this, &Positioner::syncGeometry);
+    connect(this, &Positioner::screenGeometryChanged, this, &Positioner::scheduleSyncGeometry);
 
     connect(m_view, &QQuickWindow::xChanged, this, &Positioner::validateDockGeometry);
     connect(m_view, &QQuickWindow::yChanged, this, &Positioner::validateDockGeometry);
@@ -94,42 +100,51 @@ void Positioner::init()
     connect(m_view, &QQuickWindow::screenChanged, this, &Positioner::currentScreenChanged);
     connect(m_view, &QQuickWindow::screenChanged, this, &Positioner::screenChanged);
 
-    connect(m_view, &Latte::View::behaveAsPlasmaPanelChanged, this, &Positioner::syncGeometry);
-    connect(m_view, &Latte::View::maxThicknessChanged, this, &Positioner::syncGeometry);
-    connect(m_view, &Latte::View::maxLengthChanged, this, &Positioner::syncGeometry);
-    connect(m_view, &Latte::View::offsetChanged, this, &Positioner::syncGeometry);
+    connect(m_view, &Latte::View::behaveAsPlasmaPanelChanged, this, &Positioner::scheduleSyncGeometry);
+    connect(m_view, &Latte::View::maxThicknessChanged, this, &Positioner::scheduleSyncGeometry);
+    connect(m_view, &Latte::View::maxLengthChanged, this, &Positioner::scheduleSyncGeometry);
+    connect(m_view, &Latte::View::offsetChanged, this, &Positioner::scheduleSyncGeometry);
 
     connect(m_view, &Latte::View::absGeometryChanged, this, [&]() {
         if (m_view->behaveAsPlasmaPanel()) {
-            syncGeometry();
+            scheduleSyncGeometry();
         }
     });
 
     connect(m_view, &Latte::View::locationChanged, this, [&]() {
         updateFormFactor();
-        syncGeometry();
+        scheduleSyncGeometry();
     });
 
     connect(m_view, &Latte::View::normalThicknessChanged, this, [&]() {
         if (m_view->behaveAsPlasmaPanel()) {
-            syncGeometry();
+            scheduleSyncGeometry();
         }
     });
 
     connect(m_view->effects(), &Latte::ViewPart::Effects::drawShadowsChanged, this, [&]() {
         if (!m_view->behaveAsPlasmaPanel()) {
-            syncGeometry();
+            scheduleSyncGeometry();
         }
     });
 
     connect(m_view->effects(), &Latte::ViewPart::Effects::innerShadowChanged, this, [&]() {
         if (m_view->behaveAsPlasmaPanel()) {
-            syncGeometry();
+            scheduleSyncGeometry();
         }
     });
 
-    connect(qGuiApp, &QGuiApplication::screenAdded, this, &Positioner::screenChanged);
-    connect(qGuiApp, &QGuiApplication::primaryScreenChanged, this, &Positioner::screenChanged);
+    //! outputs changes are tracked once from corona's screen topology which afterwards
+    //! reconsiders the screen for all views through syncLatteViewsToScreens
+    auto *latteCorona = qobject_cast<Latte::Corona *>(m_view->corona());
+
+    if (latteCorona) {
+        connect(latteCorona->screenTopology(), &ScreenTopology::topologyChanged, this, [&](const Latte::ScreenTopologyDiff &diff) {
+            if (diff.outputsChanged()) {
+                updateStruts();
+            }
+        });
+    }
 
     initSignalingForLocationChangeSliding();
 }
@@ -292,8 +307,22 @@ void Positioner::reconsiderScreen()
 
 void Positioner::screenChanged(QScreen *scr)
 {
-    m_screenSyncTimer.start();
+    Q_UNUSED(scr);
+
+    //! the window manager may have moved the view to another screen
+    scheduleReconsiderScreen();
+    updateStruts();
+}
+
+void Positioner::scheduleReconsiderScreen()
+{
+    if (!m_reconsiderScreenTimer.isActive()) {
+        m_reconsiderScreenTimer.start();
+    }
+}
 
+void Positioner::updateStruts()
+{
     //! this is needed in order to update the struts on screen change
     //! and even though the geometry has been set correctly the offsets
     //! of the screen must be updated to the new ones
@@ -304,6 +333,8 @@ void Positioner::screenChanged(QScreen *scr)
 
 void Positioner::syncGeometry()
 {
+    LATTE_TRACE_SCOPE("view", "Positioner::syncGeometry");
+
     if (!(m_view->screen() && m_view->containment()) || m_inDelete) {
         return;
     }
@@ -312,18 +343,19 @@ void Positioner::syncGeometry()
 
     qDebug() << "syncGeometry() called...";
 
+    //! any pending request is fulfilled by this call
+    m_syncGeometryTimer.stop();
+
     //! before updating the positioning and geometry of the dock
     //! we make sure that the dock is at the correct screen
     if (m_view->screen() != m_screenToFollow) {
         qDebug() << "Sync Geometry screens inconsistent!!!! ";
 
+        //! the view is moved back through reconsiderScreen() when its screen
+        //! changes or when the screen topology changes
         if (m_screenToFollow) {
             qDebug() << "Sync Geometry screens inconsistent for m_screenToFollow:" << m_screenToFollow->name() << " dock screen:" << m_view->screen()->name();
         }
-
-        if (!m_screenSyncTimer.isActive()) {
-            m_screenSyncTimer.start();
-        }
     } else {
         found = true;
     }
@@ -333,7 +365,7 @@ void Positioner::syncGeometry()
     if (found) {
         //! compute the free screen rectangle for vertical panels only once
         //! this way the costly QRegion computations are calculated only once
-        //! instead of two times (both inside the resizeWindow and the updatePosition)
+        //! instead of two times (both inside the windowSize and the windowPosition)
         QRegion freeRegion;;
         QRect maximumRect;
         QRect availableScreenRect{m_view->screen()->geometry()};
@@ -373,8 +405,9 @@ void Positioner::syncGeometry()
         }
 
         m_view->effects()->updateEnabledBorders();
-        resizeWindow(availableScreenRect);
-        updatePosition(availableScreenRect);
+
+        QSize size = windowSize(availableScreenRect);
+        commitGeometry(QRect(windowPosition(availableScreenRect, size), size));
 
         qDebug() << "syncGeometry() calculations for screen: " << m_view->screen()->name() << " _ " << m_view->screen()->geometry();
         qDebug() << "syncGeometry() calculations for edge: " << m_view->location();
@@ -385,13 +418,30 @@ void Positioner::syncGeometry()
     // qDebug() << "dock geometry:" << qRectToStr(geometry());
 }
 
+void Positioner::scheduleSyncGeometry()
+{
+    if (!m_syncGeometryTimer.isActive()) {
+        m_syncGeometryTimer.start();
+    }
+}
+
 void Positioner::validateDockGeometry()
 {
     if (m_view->geometry() != m_validGeometry) {
         m_validateGeometryTimer.start();
+    } else {
+        fixSizeConstraints();
     }
 }
 
+void Positioner::fixSizeConstraints()
+{
+    //! the window has already the committed size, so fixing the constraints
+    //! does not send any further configure request
+    m_view->setMinimumSize(m_validGeometry.size());
+    m_view->setMaximumSize(m_validGeometry.size());
+}
+
 //! this is used mainly from vertical panels in order to
 //! to get the maximum geometry that can be used from the dock
 //! based on their alignment type and the location dock
@@ -464,7 +514,7 @@ QRect Positioner::maximumNormalGeometry()
     return maxGeometry;
 }
 
-void Positioner::updatePosition(QRect availableScreenRect)
+QPoint Positioner::windowPosition(const QRect &availableScreenRect, const QSize &size)
 {
     QRect screenGeometry{availableScreenRect};
     QPoint position;
@@ -492,7 +542,7 @@ void Positioner::updatePosition(QRect availableScreenRect)
                             screenGeometry.y() + screenGeometry.height() - cleanThickness
                            };
             } else {
-                position = {screenGeometry.x(), screenGeometry.y() + screenGeometry.height() - m_view->height()};
+                position = {screenGeometry.x(), screenGeometry.y() + screenGeometry.height() - size.height()};
             }
 
             break;
@@ -503,7 +553,7 @@ void Positioner::updatePosition(QRect availableScreenRect)
                             availableScreenRect.y() + length(availableScreenRect.height())
                            };
             } else {
-                position = {availableScreenRect.right() - m_view->width() + 1, availableScreenRect.y()};
+                position = {availableScreenRect.right() - size.width() + 1, availableScreenRect.y()};
             }
 
             break;
@@ -522,16 +572,10 @@ void Positioner::updatePosition(QRect availableScreenRect)
                        << m_view->location();
     }
 
-    m_validGeometry.setTopLeft(position);
-
-    m_view->setPosition(position);
-
-    if (m_view->surface()) {
-        m_view->surface()->setPosition(position);
-    }
+    return position;
 }
 
-void Positioner::resizeWindow(QRect availableScreenRect)
+QSize Positioner::windowSize(const QRect &availableScreenRect) const
 {
     QSize screenSize = m_view->screen()->size();
     QSize size = (m_view->formFactor() == Plasma::Types::Vertical) ? QSize(m_view->maxThickness(), availableScreenRect.height()) : QSize(screenSize.width(), m_view->maxThickness());
@@ -549,13 +593,34 @@ void Positioner::resizeWindow(QRect availableScreenRect)
         }
     }
 
-    m_validGeometry.setSize(size);
+    return size;
+}
+
+void Positioner::commitGeometry(const QRect &geometry)
+{
+    bool changed = (m_view->geometry() != geometry);
+
+    m_validGeometry = geometry;
+
+    //! position and size are sent together, that way the window system
+    //! receives a single configure request instead of a resize followed
+    //! by a move. Struts, masks and input regions are not part of it, they
+    //! follow the window geometry when the window system has applied it
+    if (changed) {
+        //! the size constraints are only relaxed here, that never resizes the
+        //! window, they are fixed again when the new geometry has been applied
+        m_view->setMinimumSize(m_view->minimumSize().boundedTo(geometry.size()));
+        m_view->setMaximumSize(m_view->maximumSize().expandedTo(geometry.size()));
+        m_view->setGeometry(geometry);
+    } else {
+        fixSizeConstraints();
+    }
 
-    m_view->setMinimumSize(size);
-    m_view->setMaximumSize(size);
-    m_view->resize(size);
+    if (m_view->surface()) {
+        m_view->surface()->setPosition(geometry.topLeft());
+    }
 
-    if (m_view->formFactor() == Plasma::Types::Horizontal && m_view->corona()) {
+    if (changed && m_view->formFactor() == Plasma::Types::Horizontal && m_view->corona()) {
         emit m_view->corona()->availableScreenRectChanged();
     }
 }
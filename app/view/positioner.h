@@ -87,15 +87,23 @@ signals:
 
 private slots:
     void screenChanged(QScreen *screen);
+    void scheduleSyncGeometry();
     void validateDockGeometry();
 
 private:
     void init();
     void initSignalingForLocationChangeSliding();
-    void resizeWindow(QRect availableScreenRect = QRect());
 
+    //! geometry transaction, the final window geometry is first calculated
+    //! and afterwards it is applied to the window system at once
+    void commitGeometry(const QRect &geometry);
+    void fixSizeConstraints();
+    QPoint windowPosition(const QRect &availableScreenRect, const QSize &size);
+    QSize windowSize(const QRect &availableScreenRect) const;
+
+    void scheduleReconsiderScreen();
     void updateFormFactor();
-    void updatePosition(QRect availableScreenRect = QRect());
+    void updateStruts();
 
     QRect maximumNormalGeometry();
 
@@ -109,8 +117,9 @@ private:
 
     QString m_screenToFollowId;
     QPointer<QScreen> m_screenToFollow;
-    QTimer m_screenSyncTimer;
+    QTimer m_reconsiderScreenTimer;
 
+    QTimer m_syncGeometryTimer;
     QTimer m_validateGeometryTimer;
 
     //!used at sliding out/in animation
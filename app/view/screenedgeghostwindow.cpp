@@ -25,8 +25,8 @@
 
 // Qt
 #include <QDebug>
+#include <QPainter>
 #include <QSurfaceFormat>
-#include <QQuickView>
 #include <QTimer>
 
 // KDE
@@ -43,8 +43,9 @@ namespace ViewPart {
 ScreenEdgeGhostWindow::ScreenEdgeGhostWindow(Latte::View *view) :
     m_latteView(view)
 {
-    setColor(QColor(Qt::transparent));
-    setDefaultAlphaBuffer(true);
+    QSurfaceFormat format;
+    format.setAlphaBufferSize(8);
+    setFormat(format);
 
     setFlags(Qt::FramelessWindowHint
              | Qt::WindowStaysOnTopHint
@@ -55,10 +56,10 @@ ScreenEdgeGhostWindow::ScreenEdgeGhostWindow(Latte::View *view) :
     m_fixGeometryTimer.setInterval(500);
     connect(&m_fixGeometryTimer, &QTimer::timeout, this, &ScreenEdgeGhostWindow::fixGeometry);
 
-    connect(this, &QQuickView::xChanged, this, &ScreenEdgeGhostWindow::startGeometryTimer);
-    connect(this, &QQuickView::yChanged, this, &ScreenEdgeGhostWindow::startGeometryTimer);
-    connect(this, &QQuickView::widthChanged, this, &ScreenEdgeGhostWindow::startGeometryTimer);
-    connect(this, &QQuickView::heightChanged, this, &ScreenEdgeGhostWindow::startGeometryTimer);
+    connect(this, &QWindow::xChanged, this, &ScreenEdgeGhostWindow::startGeometryTimer);
+    connect(this, &QWindow::yChanged, this, &ScreenEdgeGhostWindow::startGeometryTimer);
+    connect(this, &QWindow::widthChanged, this, &ScreenEdgeGhostWindow::startGeometryTimer);
+    connect(this, &QWindow::heightChanged, this, &ScreenEdgeGhostWindow::startGeometryTimer);
 
     connect(m_latteView, &Latte::View::absGeometryChanged, this, &ScreenEdgeGhostWindow::updateGeometry);
     connect(m_latteView, &Latte::View::screenGeometryChanged, this, &ScreenEdgeGhostWindow::updateGeometry);
@@ -224,7 +225,16 @@ bool ScreenEdgeGhostWindow::event(QEvent *e)
         emit containsMouseChanged(false);
     }
 
-    return QQuickView::event(e);
+    return QRasterWindow::event(e);
+}
+
+void ScreenEdgeGhostWindow::paintEvent(QPaintEvent *event)
+{
+    Q_UNUSED(event);
+
+    QPainter painter(this);
+    painter.setCompositionMode(QPainter::CompositionMode_Source);
+    painter.fillRect(QRect(QPoint(0, 0), size()), Qt::transparent);
 }
 
 void ScreenEdgeGhostWindow::hideWithMask()
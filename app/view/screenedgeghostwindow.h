@@ -22,7 +22,7 @@
 
 // Qt
 #include <QObject>
-#include <QQuickView>
+#include <QRasterWindow>
 #include <QTimer>
 
 namespace KWayland {
@@ -54,8 +54,13 @@ namespace ViewPart {
 //!
 //! KDE BUGS: https://bugs.kde.org/show_bug.cgi?id=382219
 //!           https://bugs.kde.org/show_bug.cgi?id=392464
+//!
+//! The window does not draw anything, so it is a raster window without
+//! any qml scene, it does not need a GL context or a render thread.
+//! An X11 InputOnly window can not be used because KWin does not manage
+//! such windows and as such it ignores their screen edge requests.
 
-class ScreenEdgeGhostWindow : public QQuickView
+class ScreenEdgeGhostWindow : public QRasterWindow
 {
     Q_OBJECT
 
@@ -77,6 +82,7 @@ signals:
 
 protected:
     bool event(QEvent *ev) override;
+    void paintEvent(QPaintEvent *event) override;
 
 private slots:
     void startGeometryTimer();
@@ -116,8 +116,6 @@ PrimaryConfigView::~PrimaryConfigView()
 void PrimaryConfigView::init()
 {
     qDebug() << "dock config view : initialization started...";
-    m_originalByPassWM = m_latteView->byPassWM();
-    m_originalMode = m_latteView->visibility()->mode();
 
     loadConfig();
 
@@ -184,7 +182,8 @@ QRect PrimaryConfigView::geometryWhenVisible() const
 
 void PrimaryConfigView::syncGeometry()
 {
-    if (!m_latteView || !m_latteView->managedLayout() || !m_latteView->containment() || !rootObject()) {
+    //! a hidden window that is kept for reuse is synced again when it is shown
+    if (!isVisible() || !m_latteView || !m_latteView->managedLayout() || !m_latteView->containment() || !rootObject()) {
         return;
     }
 
@@ -289,6 +288,10 @@ void PrimaryConfigView::showEvent(QShowEvent *ev)
         return;
     }
 
+    //! the window can be reused, the view state is tracked from every showing
+    m_originalByPassWM = m_latteView->byPassWM();
+    m_originalMode = m_latteView->visibility()->mode();
+
     m_corona->wm()->setViewExtraFlags(*this);
     setFlags(wFlags());
 
@@ -308,6 +311,9 @@ void PrimaryConfigView::showEvent(QShowEvent *ev)
 
 void PrimaryConfigView::hideEvent(QHideEvent *ev)
 {
+    m_screenSyncTimer.stop();
+    m_thicknessSyncTimer.stop();
+
     if (!m_latteView) {
         QQuickWindow::hideEvent(ev);
         return;
@@ -331,7 +337,14 @@ void PrimaryConfigView::hideEvent(QHideEvent *ev)
         m_latteView->managedLayout()->recreateView(m_latteView->containment());
     }
 
-    deleteLater();
+    //! under wayland the window surface is destroyed when it is closed, so
+    //! the window is kept only under X11 in order to be shown again instantly
+    //! the next time the settings are requested for the same view
+    if (KWindowSystem::isPlatformWayland()) {
+        deleteLater();
+    } else if (m_secConfigView) {
+        m_secConfigView->hide();
+    }
 }
 
 void PrimaryConfigView::focusOutEvent(QFocusEvent *ev)
@@ -447,7 +460,8 @@ void PrimaryConfigView::setShowInlineProperties(bool show)
 
 void PrimaryConfigView::updateShowInlineProperties()
 {
-    if (!m_latteView) {
+    //! it must not create and show the secondary window while the settings are closed
+    if (!isVisible() || !m_latteView) {
         return;
     }
 
@@ -63,8 +63,10 @@ namespace Latte {
 //! are needed in order for window flags to be set correctly
 View::View(Plasma::Corona *corona, QScreen *targetScreen, bool byPassWM)
     : PlasmaQuick::ContainmentView(corona),
+      m_configStore(new ViewPart::ConfigStore(this)),
       m_contextMenu(new ViewPart::ContextMenu(this)),
       m_effects(new ViewPart::Effects(this)),
+      m_frameStatistics(new ViewPart::FrameStatistics(this)),
       m_positioner(new ViewPart::Positioner(this)) //needs to be created after Effects because it catches some of its signals
 {
     setTitle(corona->kPackage().metadata().name());
@@ -138,6 +140,10 @@ View::~View()
 {
     m_inDelete = true;
 
+    if (m_configStore) {
+        m_configStore->flush();
+    }
+
     disconnect(corona(), &Plasma::Corona::availableScreenRectChanged, this, &View::availableScreenRectChanged);
     disconnect(containment(), SIGNAL(statusChanged(Plasma::Types::ItemStatus)), this, SLOT(statusChanged(Plasma::Types::ItemStatus)));
 
@@ -157,6 +163,7 @@ View::~View()
 
     if (m_configView) {
         m_configView->setVisible(false);//hide();
+        m_configView->deleteLater();
     }
 
     if (m_contextMenu) {
@@ -172,6 +179,10 @@ View::~View()
         delete m_effects;
     }
 
+    if (m_frameStatistics) {
+        delete m_frameStatistics;
+    }
+
     if (m_visibility) {
         delete m_visibility;
     }
@@ -238,6 +249,11 @@ void View::disconnectSensitiveSignals()
     disconnect(corona(), &Plasma::Corona::availableScreenRectChanged, this, &View::availableScreenRectChanged);
     setManagedLayout(nullptr);
 
+    //! the containment is going to be unloaded before the view
+    if (m_configStore) {
+        m_configStore->flush();
+    }
+
     if (m_windowsTracker) {
         m_windowsTracker->setEnabled(false);
     }
@@ -311,7 +327,8 @@ bool View::settingsWindowIsShown()
 {
     auto configView = qobject_cast<ViewPart::PrimaryConfigView *>(m_configView);
 
-    return (configView != nullptr);
+    //! the settings window is kept hidden after closing it in order to be reused
+    return (configView != nullptr && configView->isVisible());
 }
 
 void View::showSettingsWindow()
@@ -917,11 +934,21 @@ bool View::mimeContainsPlasmoid(QMimeData *mimeData, QString name)
     return false;
 }
 
+ViewPart::ConfigStore *View::configStore() const
+{
+    return m_configStore;
+}
+
 ViewPart::Effects *View::effects() const
 {
     return m_effects;
 }
 
+ViewPart::FrameStatistics *View::frameStatistics() const
+{
+    return m_frameStatistics;
+}
+
 ViewPart::Positioner *View::positioner() const
 {
     return m_positioner;
@@ -1087,12 +1114,10 @@ void View::saveConfig()
     if (!this->containment())
         return;
 
-    auto config = this->containment()->config();
-    config.writeEntry("onPrimary", onPrimary());
-    config.writeEntry("byPassWM", byPassWM());
-    config.writeEntry("isPreferredForShortcuts", isPreferredForShortcuts());
-    config.writeEntry("viewType", (int)m_type);
-    config.sync();
+    m_configStore->writeEntry("onPrimary", onPrimary());
+    m_configStore->writeEntry("byPassWM", byPassWM());
+    m_configStore->writeEntry("isPreferredForShortcuts", isPreferredForShortcuts());
+    m_configStore->writeEntry("viewType", (int)m_type);
 }
 
 void View::restoreConfig()
@@ -1100,10 +1125,9 @@ void View::restoreConfig()
     if (!this->containment())
         return;
 
-    auto config = this->containment()->config();
-    m_onPrimary = config.readEntry("onPrimary", true);
-    m_byPassWM = config.readEntry("byPassWM", false);
-    m_isPreferredForShortcuts = config.readEntry("isPreferredForShortcuts", false);
+    m_onPrimary = m_configStore->readEntry("onPrimary", true);
+    m_byPassWM = m_configStore->readEntry("byPassWM", false);
+    m_isPreferredForShortcuts = m_configStore->readEntry("isPreferredForShortcuts", false);
 
     //! Send changed signals at the end in order to be sure that saveConfig
     //! wont rewrite default/invalid values
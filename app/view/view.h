@@ -22,7 +22,9 @@
 #define VIEW_H
 
 // local
+#include "configstore.h"
 #include "effects.h"
+#include "framestatistics.h"
 #include "positioner.h"
 #include "visibilitymanager.h"
 #include "windowstracker.h"
@@ -95,6 +97,7 @@ class View : public PlasmaQuick::ContainmentView
     Q_PROPERTY(float maxLength READ maxLength WRITE setMaxLength NOTIFY maxLengthChanged)
 
     Q_PROPERTY(Latte::ViewPart::Effects *effects READ effects NOTIFY effectsChanged)
+    Q_PROPERTY(Latte::ViewPart::FrameStatistics *frameStatistics READ frameStatistics NOTIFY frameStatisticsChanged)
     Q_PROPERTY(Layout *managedLayout READ managedLayout WRITE setManagedLayout NOTIFY managedLayoutChanged)
     Q_PROPERTY(Latte::ViewPart::Positioner *positioner READ positioner NOTIFY positionerChanged)
     Q_PROPERTY(Latte::ViewPart::VisibilityManager *visibility READ visibility NOTIFY visibilityChanged)
@@ -164,7 +167,9 @@ public:
     bool settingsWindowIsShown();
     void showSettingsWindow();
 
+    ViewPart::ConfigStore *configStore() const;
     ViewPart::Effects *effects() const;
+    ViewPart::FrameStatistics *frameStatistics() const;
     ViewPart::Positioner *positioner() const;
     ViewPart::VisibilityManager *visibility() const;
     ViewPart::WindowsTracker *windowsTracker() const;
@@ -223,6 +228,7 @@ signals:
     void contextMenuIsShownChanged();
     void dockLocationChanged();
     void effectsChanged();
+    void frameStatisticsChanged();
     void fontPixelSizeChanged();
     void widthChanged();
     void heightChanged();
@@ -285,8 +291,10 @@ private:
     Layout *m_managedLayout{nullptr};
     QPointer<PlasmaQuick::ConfigView> m_configView;
 
+    QPointer<ViewPart::ConfigStore> m_configStore;
     QPointer<ViewPart::ContextMenu> m_contextMenu;
     QPointer<ViewPart::Effects> m_effects;
+    QPointer<ViewPart::FrameStatistics> m_frameStatistics;
     QPointer<ViewPart::Positioner> m_positioner;
     QPointer<ViewPart::VisibilityManager> m_visibility;
     QPointer<ViewPart::WindowsTracker> m_windowsTracker;
@@ -65,6 +65,10 @@ VisibilityManager::VisibilityManager(PlasmaQuick::ContainmentView *view)
     m_timerShow.setSingleShot(true);
     m_timerHide.setSingleShot(true);
 
+    //! views that stay hidden for that long release their scene graph resources
+    m_timerReleaseResources.setInterval(10000);
+    m_timerReleaseResources.setSingleShot(true);
+
     connect(&m_timerShow, &QTimer::timeout, this, [&]() {
         if (m_isHidden) {
             //   qDebug() << "must be shown";
@@ -77,6 +81,13 @@ VisibilityManager::VisibilityManager(PlasmaQuick::ContainmentView *view)
             emit mustBeHide();
         }
     });
+    connect(&m_timerReleaseResources, &QTimer::timeout, this, &VisibilityManager::releaseResources);
+
+    //! the view is going to be shown, its animations must be resumed before sliding in
+    connect(this, &VisibilityManager::mustBeShown, this, [&]() {
+        m_timerReleaseResources.stop();
+        setResourcesReleased(false);
+    });
     wm->setViewExtraFlags(*m_latteView);
     wm->addView(m_latteView->winId());
 
@@ -130,6 +141,7 @@ void VisibilityManager::setMode(Latte::Types::Visibility mode)
 
     m_timerShow.stop();
     m_timerHide.stop();
+    m_activeWindowInfo = WindowInfoWrap();
     m_mode = mode;
 
     switch (m_mode) {
@@ -187,7 +199,7 @@ void VisibilityManager::setMode(Latte::Types::Visibility mode)
             connections[0] = connect(wm, &WindowSystem::activeWindowChanged
                                      , this, &VisibilityManager::dodgeActive);
             connections[1] = connect(wm, &WindowSystem::windowChanged
-                                     , this, &VisibilityManager::dodgeActive);
+                                     , this, &VisibilityManager::dodgeWindowChanged);
             dodgeActive(wm->activeWindow());
         }
         break;
@@ -201,7 +213,7 @@ void VisibilityManager::setMode(Latte::Types::Visibility mode)
             connections[0] = connect(wm, &WindowSystem::activeWindowChanged
                                      , this, &VisibilityManager::dodgeMaximized);
             connections[1] = connect(wm, &WindowSystem::windowChanged
-                                     , this, &VisibilityManager::dodgeMaximized);
+                                     , this, &VisibilityManager::dodgeWindowChanged);
             dodgeMaximized(wm->activeWindow());
         }
         break;
@@ -233,7 +245,7 @@ void VisibilityManager::setMode(Latte::Types::Visibility mode)
             break;
     }
 
-    m_latteView->containment()->config().writeEntry("visibility", static_cast<int>(m_mode));
+    m_latteView->configStore()->writeEntry("visibility", static_cast<int>(m_mode));
 
     updateKWinEdgesSupport();
 
@@ -311,9 +323,44 @@ void VisibilityManager::setIsHidden(bool isHidden)
         }
     }
 
+    if (m_isHidden) {
+        m_timerReleaseResources.start();
+    } else {
+        m_timerReleaseResources.stop();
+        setResourcesReleased(false);
+    }
+
     emit isHiddenChanged();
 }
 
+bool VisibilityManager::resourcesReleased() const
+{
+    return m_resourcesReleased;
+}
+
+void VisibilityManager::setResourcesReleased(bool released)
+{
+    if (m_resourcesReleased == released) {
+        return;
+    }
+
+    m_resourcesReleased = released;
+    emit resourcesReleasedChanged();
+}
+
+void VisibilityManager::releaseResources()
+{
+    if (!m_isHidden || m_latteView->inEditMode()) {
+        return;
+    }
+
+    //! the paused animations do not request new frames, the textures and
+    //! glyph caches that are not used any more are freed until the view
+    //! is shown again and they are recreated on demand
+    setResourcesReleased(true);
+    m_latteView->releaseResources();
+}
+
 bool VisibilityManager::blockHiding() const
 {
     return m_blockHiding;
@@ -473,18 +520,14 @@ void VisibilityManager::dodgeActive(WindowId wid)
         return;
     }
 
-    auto winfo = wm->requestInfo(wid);
-
-    if (!winfo.isValid() || !winfo.isActive()) {
-        winfo = wm->requestInfo(wm->activeWindow());
-
-        if (!winfo.isValid()) {
-            //! very rare case that window manager doesn't have any active window at all
-            raiseView(true);
-            return;
-        }
+    if (!updateActiveWindowInfo(wid)) {
+        //! very rare case that window manager doesn't have any active window at all
+        raiseView(true);
+        return;
     }
 
+    const WindowInfoWrap &winfo = m_activeWindowInfo;
+
     //! don't send false raiseView signal when containing mouse, // Johan comment
     //! I don't know why that wasn't winfo.wid() //active window, but just wid//the window that made the call
     if (wm->isOnCurrentDesktop(winfo.wid()) && wm->isOnCurrentActivity(winfo.wid())) {
@@ -504,18 +547,14 @@ void VisibilityManager::dodgeMaximized(WindowId wid)
         return;
     }
 
-    auto winfo = wm->requestInfo(wid);
-
-    if (!winfo.isValid() || !winfo.isActive()) {
-        winfo = wm->requestInfo(wm->activeWindow());
-
-        if (!winfo.isValid()) {
-            //! very rare case that window manager doesn't have any active window at all
-            raiseView(true);
-            return;
-        }
+    if (!updateActiveWindowInfo(wid)) {
+        //! very rare case that window manager doesn't have any active window at all
+        raiseView(true);
+        return;
     }
 
+    const WindowInfoWrap &winfo = m_activeWindowInfo;
+
     auto intersectsMaxVert = [&]() noexcept -> bool {
         return ((winfo.isMaxVert()
                  || (m_latteView->screen() && m_latteView->screen()->availableSize().height() <= winfo.geometry().height()))
@@ -536,6 +575,35 @@ void VisibilityManager::dodgeMaximized(WindowId wid)
     }
 }
 
+void VisibilityManager::dodgeWindowChanged(WindowId wid)
+{
+    //! the dodge modes are evaluated only against the active window, so the
+    //! changes of any other window are ignored without asking the window
+    //! manager anything about them
+    if (m_activeWindowInfo.isValid() && m_activeWindowInfo.wid() != wid) {
+        return;
+    }
+
+    if (m_mode == Types::DodgeActive) {
+        dodgeActive(wid);
+    } else if (m_mode == Types::DodgeMaximized) {
+        dodgeMaximized(wid);
+    }
+}
+
+bool VisibilityManager::updateActiveWindowInfo(WindowId wid)
+{
+    WindowId activeWid = wm->activeWindow();
+
+    //! the active window record is refreshed only when it is the window that
+    //! changed or when the active window is not the cached one any more
+    if (wid == activeWid || !m_activeWindowInfo.isValid() || m_activeWindowInfo.wid() != activeWid) {
+        m_activeWindowInfo = wm->requestInfo(activeWid);
+    }
+
+    return m_activeWindowInfo.isValid();
+}
+
 void VisibilityManager::dodgeAllWindows()
 {
     if (raiseTemporarily)
@@ -564,15 +632,13 @@ void VisibilityManager::saveConfig()
     if (!m_latteView->containment())
         return;
 
-    auto config = m_latteView->containment()->config();
-
-    config.writeEntry("enableKWinEdges", enableKWinEdgesFromUser);
-    config.writeEntry("timerShow", m_timerShow.interval());
-    config.writeEntry("timerHide", m_timerHide.interval());
-    config.writeEntry("raiseOnDesktopChange", raiseOnDesktopChange);
-    config.writeEntry("raiseOnActivityChange", raiseOnActivityChange);
+    auto config = m_latteView->configStore();
 
-    m_latteView->containment()->configNeedsSaving();
+    config->writeEntry("enableKWinEdges", enableKWinEdgesFromUser);
+    config->writeEntry("timerShow", m_timerShow.interval());
+    config->writeEntry("timerHide", m_timerHide.interval());
+    config->writeEntry("raiseOnDesktopChange", raiseOnDesktopChange);
+    config->writeEntry("raiseOnActivityChange", raiseOnActivityChange);
 }
 
 void VisibilityManager::restoreConfig()
@@ -581,26 +647,26 @@ void VisibilityManager::restoreConfig()
         return;
     }
 
-    auto config = m_latteView->containment()->config();
-    m_timerShow.setInterval(config.readEntry("timerShow", 0));
-    m_timerHide.setInterval(config.readEntry("timerHide", 700));
+    auto config = m_latteView->configStore();
+    m_timerShow.setInterval(config->readEntry("timerShow", 0));
+    m_timerHide.setInterval(config->readEntry("timerHide", 700));
     emit timerShowChanged();
     emit timerHideChanged();
 
-    enableKWinEdgesFromUser = config.readEntry("enableKWinEdges", true);
+    enableKWinEdgesFromUser = config->readEntry("enableKWinEdges", true);
     emit enableKWinEdgesChanged();
 
-    setRaiseOnDesktop(config.readEntry("raiseOnDesktopChange", false));
-    setRaiseOnActivity(config.readEntry("raiseOnActivityChange", false));
+    setRaiseOnDesktop(config->readEntry("raiseOnDesktopChange", false));
+    setRaiseOnActivity(config->readEntry("raiseOnActivityChange", false));
 
-    auto storedMode = static_cast<Types::Visibility>(m_latteView->containment()->config().readEntry("visibility", static_cast<int>(Types::DodgeActive)));
+    auto storedMode = static_cast<Types::Visibility>(config->readEntry("visibility", static_cast<int>(Types::DodgeActive)));
 
     if (storedMode == Types::AlwaysVisible) {
         qDebug() << "Loading visibility mode: Always Visible , on startup...";
         setMode(Types::AlwaysVisible);
     } else {
         connect(&m_timerStartUp, &QTimer::timeout, this, [&]() {
-            auto fMode = static_cast<Types::Visibility>(m_latteView->containment()->config().readEntry("visibility", static_cast<int>(Types::DodgeActive)));
+            auto fMode = static_cast<Types::Visibility>(m_latteView->configStore()->readEntry("visibility", static_cast<int>(Types::DodgeActive)));
             qDebug() << "Loading visibility mode:" << fMode << " on startup...";
             setMode(fMode);
         });
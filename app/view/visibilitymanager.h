@@ -56,6 +56,8 @@ class VisibilityManager : public QObject
     Q_PROPERTY(bool isHidden READ isHidden WRITE setIsHidden NOTIFY isHiddenChanged)
     Q_PROPERTY(bool blockHiding READ blockHiding WRITE setBlockHiding NOTIFY blockHidingChanged)
     Q_PROPERTY(bool containsMouse READ containsMouse NOTIFY containsMouseChanged)
+    //! the view is hidden for a while and its scene graph resources have been released
+    Q_PROPERTY(bool resourcesReleased READ resourcesReleased NOTIFY resourcesReleasedChanged)
 
     //! KWin Edges Support Options
     Q_PROPERTY(bool enableKWinEdges READ enableKWinEdges WRITE setEnableKWinEdges NOTIFY enableKWinEdgesChanged)
@@ -87,6 +89,8 @@ public:
 
     bool containsMouse() const;
 
+    bool resourcesReleased() const;
+
     int timerShow() const;
     void setTimerShow(int msec);
 
@@ -114,6 +118,7 @@ signals:
     void isHiddenChanged();
     void blockHidingChanged();
     void containsMouseChanged();
+    void resourcesReleasedChanged();
     void timerShowChanged();
     void timerHideChanged();
 
@@ -127,6 +132,9 @@ private slots:
 
 private:
     void setContainsMouse(bool contains);
+    void setResourcesReleased(bool released);
+
+    void releaseResources();
 
     void raiseView(bool raise);
     void raiseViewTemporarily();
@@ -143,6 +151,11 @@ private:
     void windowAdded(WindowId id);
     void dodgeActive(WindowId id);
     void dodgeMaximized(WindowId id);
+    void dodgeWindowChanged(WindowId id);
+
+    //! it refreshes the cached active window record and returns false when
+    //! the window manager does not have any active window
+    bool updateActiveWindowInfo(WindowId id);
 
     void updateStrutsBasedOnLayoutsAndActivities();
     void viewEventManager(QEvent *ev);
@@ -158,11 +171,15 @@ private:
     QTimer m_timerShow;
     QTimer m_timerHide;
     QTimer m_timerStartUp;
+    QTimer m_timerReleaseResources;
     QRect m_viewGeometry;
+    //! the active window record that the dodge modes are evaluated against
+    WindowInfoWrap m_activeWindowInfo;
     bool m_isHidden{false};
     bool dragEnter{false};
     bool m_blockHiding{false};
     bool m_containsMouse{false};
+    bool m_resourcesReleased{false};
     bool raiseTemporarily{false};
     bool raiseOnDesktopChange{false};
     bool raiseOnActivityChange{false};
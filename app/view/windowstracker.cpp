@@ -23,6 +23,8 @@
 #include "positioner.h"
 #include "view.h"
 #include "../lattecorona.h"
+#include "../../liblatte2/statistics.h"
+#include "../../liblatte2/tracer.h"
 #include "../../liblatte2/types.h"
 
 namespace Latte {
@@ -109,6 +111,11 @@ SchemeColors *WindowsTracker::touchingWindowScheme() const
     return m_touchingScheme;
 }
 
+quint64 WindowsTracker::updateFlagsRuns() const
+{
+    return m_updateFlagsRuns;
+}
+
 void WindowsTracker::setTouchingWindowScheme(SchemeColors *scheme)
 {
     if (m_touchingScheme == scheme) {
@@ -212,6 +219,10 @@ void WindowsTracker::updateAvailableScreenGeometry()
 
 void WindowsTracker::updateFlags()
 {
+    LATTE_TRACE_SCOPE("view", "WindowsTracker::updateFlags");
+    LATTE_COUNT(UpdateFlagsRuns);
+    m_updateFlagsRuns++;
+
     bool foundActive{false};
     bool foundActiveTouch{false};
     bool foundTouch{false};
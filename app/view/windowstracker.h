@@ -31,6 +31,7 @@
 namespace Latte{
     class AbstractWindowInterface;
     class Corona;
+    class CoronaBenchmarks;
     class View;
 }
 
@@ -60,6 +61,8 @@ public:
     SchemeColors *activeWindowScheme() const;
     SchemeColors *touchingWindowScheme() const;
 
+    quint64 updateFlagsRuns() const;
+
     void setWindowOnActivities(QWindow &window, const QStringList &activities);
 
 signals:
@@ -98,6 +101,8 @@ private:
     bool m_windowIsTouchingFlag{false};
     bool m_windowIsMaximizedFlag{false};
 
+    quint64 m_updateFlagsRuns{0};
+
     QRect m_availableScreenGeometry;
 
     WindowId m_lastActiveWindowWid;
@@ -111,6 +116,8 @@ private:
     Latte::AbstractWindowInterface *m_wm;
     Latte::Corona *m_corona{nullptr};
     Latte::View *m_latteView{nullptr};
+
+    friend class Latte::CoronaBenchmarks;
 };
 
 }
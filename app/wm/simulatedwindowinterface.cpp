@@ -0,0 +1,554 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "simulatedwindowinterface.h"
+
+// local
+#include "windoweventsreplay.h"
+#include "view/screenedgeghostwindow.h"
+#include "../liblatte2/statistics.h"
+
+// Qt
+#include <QDebug>
+#include <QFile>
+#include <QTextStream>
+
+namespace Latte {
+
+SimulatedWindowInterface::SimulatedWindowInterface(QObject *parent)
+    : AbstractWindowInterface(parent)
+{
+    m_scriptTimer.setSingleShot(true);
+    connect(&m_scriptTimer, &QTimer::timeout, this, &SimulatedWindowInterface::runNextCommand);
+}
+
+SimulatedWindowInterface::~SimulatedWindowInterface()
+{
+    m_scriptTimer.stop();
+}
+
+void SimulatedWindowInterface::setViewExtraFlags(QWindow &view)
+{
+    Q_UNUSED(view)
+}
+
+void SimulatedWindowInterface::setViewStruts(QWindow &view, const QRect &rect
+        , Plasma::Types::Location location)
+{
+    Q_UNUSED(location)
+    m_struts[view.winId()] = rect;
+}
+
+void SimulatedWindowInterface::setWindowOnActivities(QWindow &window, const QStringList &activities)
+{
+    Q_UNUSED(window)
+    Q_UNUSED(activities)
+}
+
+void SimulatedWindowInterface::removeViewStruts(QWindow &view) const
+{
+    //! the struts are only a record for the simulation
+    const_cast<SimulatedWindowInterface *>(this)->m_struts.remove(view.winId());
+}
+
+WindowId SimulatedWindowInterface::activeWindow() const
+{
+    return QVariant::fromValue<WId>(m_activeWindow);
+}
+
+WindowInfoWrap SimulatedWindowInterface::requestInfo(WindowId wid) const
+{
+    LATTE_COUNT(RequestInfoCalls);
+
+    if (!contains(wid)) {
+        return WindowInfoWrap();
+    }
+
+    return m_table.value(key(wid)).info;
+}
+
+WindowInfoWrap SimulatedWindowInterface::requestInfoActive() const
+{
+    return requestInfo(activeWindow());
+}
+
+bool SimulatedWindowInterface::isOnCurrentDesktop(WindowId wid) const
+{
+    if (!contains(wid)) {
+        return true;
+    }
+
+    const Window window = m_table.value(key(wid));
+
+    return window.desktop == 0 || window.desktop == m_currentDesktop;
+}
+
+bool SimulatedWindowInterface::isOnCurrentActivity(WindowId wid) const
+{
+    if (!contains(wid)) {
+        return true;
+    }
+
+    const Window window = m_table.value(key(wid));
+
+    return window.activities.isEmpty() || window.activities.contains(m_currentActivity);
+}
+
+const std::list<WindowId> &SimulatedWindowInterface::windows() const
+{
+    return m_windows;
+}
+
+void SimulatedWindowInterface::setKeepAbove(const QDialog &dialog, bool above) const
+{
+    Q_UNUSED(dialog)
+    Q_UNUSED(above)
+}
+
+void SimulatedWindowInterface::skipTaskBar(const QDialog &dialog) const
+{
+    Q_UNUSED(dialog)
+}
+
+void SimulatedWindowInterface::slideWindow(QWindow &view, AbstractWindowInterface::Slide location) const
+{
+    Q_UNUSED(view)
+    Q_UNUSED(location)
+}
+
+void SimulatedWindowInterface::enableBlurBehind(QWindow &view) const
+{
+    Q_UNUSED(view)
+}
+
+void SimulatedWindowInterface::releaseMouseEventFor(WindowId wid) const
+{
+    Q_UNUSED(wid)
+}
+
+void SimulatedWindowInterface::requestToggleMaximized(WindowId wid) const
+{
+    if (!contains(wid)) {
+        return;
+    }
+
+    const bool maximized = m_table.value(key(wid)).info.isMaximized();
+
+    //! the requests are delivered asynchronously as a real window manager would do
+    QTimer::singleShot(0, const_cast<SimulatedWindowInterface *>(this), [this, wid, maximized]() {
+        const_cast<SimulatedWindowInterface *>(this)->setMaximized(wid, !maximized);
+    });
+}
+
+void SimulatedWindowInterface::requestMoveWindow(WindowId wid, QPoint from) const
+{
+    if (!windowCanBeDragged(wid)) {
+        return;
+    }
+
+    QRect geometry = m_table.value(key(wid)).info.geometry();
+    geometry.moveTopLeft(from);
+
+    QTimer::singleShot(0, const_cast<SimulatedWindowInterface *>(this), [this, wid, geometry]() {
+        SimulatedWindowInterface *wm = const_cast<SimulatedWindowInterface *>(this);
+        wm->setMaximized(wid, false);
+        wm->moveWindow(wid, geometry);
+    });
+}
+
+bool SimulatedWindowInterface::windowCanBeDragged(WindowId wid) const
+{
+    if (!contains(wid)) {
+        return false;
+    }
+
+    const WindowInfoWrap info = m_table.value(key(wid)).info;
+
+    return !info.isPlasmaDesktop() && !info.hasSkipTaskbar() && isOnCurrentDesktop(wid) && isOnCurrentActivity(wid);
+}
+
+void SimulatedWindowInterface::setEdgeStateFor(QWindow *view, bool active) const
+{
+    ViewPart::ScreenEdgeGhostWindow *window = qobject_cast<ViewPart::ScreenEdgeGhostWindow *>(view);
+
+    if (!window) {
+        return;
+    }
+
+    if (active) {
+        window->showWithMask();
+    } else {
+        window->hideWithMask();
+    }
+}
+
+QHash<WId, QRect> SimulatedWindowInterface::struts() const
+{
+    return m_struts;
+}
+
+bool SimulatedWindowInterface::contains(WindowId wid) const
+{
+    return m_table.contains(key(wid));
+}
+
+WId SimulatedWindowInterface::key(WindowId wid) const
+{
+    return wid.value<WId>();
+}
+
+void SimulatedWindowInterface::updateWindow(WindowId wid, std::function<void(Window &)> update)
+{
+    if (!contains(wid)) {
+        return;
+    }
+
+    Window &window = m_table[key(wid)];
+    const WindowInfoWrap previous = window.info;
+    const int previousDesktop = window.desktop;
+    const QStringList previousActivities = window.activities;
+
+    update(window);
+
+    if (window.info.geometry() != previous.geometry()
+        || window.info.isMinimized() != previous.isMinimized()
+        || window.info.isMaxVert() != previous.isMaxVert()
+        || window.info.isMaxHoriz() != previous.isMaxHoriz()
+        || window.info.isFullscreen() != previous.isFullscreen()
+        || window.info.isShaded() != previous.isShaded()
+        || window.info.isKeepAbove() != previous.isKeepAbove()
+        || window.desktop != previousDesktop
+        || window.activities != previousActivities) {
+        emit windowChanged(wid);
+    }
+}
+
+WindowId SimulatedWindowInterface::createWindow(const QRect &geometry, int desktop, const QStringList &activities)
+{
+    const WId id = m_nextId++;
+    const WindowId wid = QVariant::fromValue<WId>(id);
+
+    Window window;
+    window.info.setIsValid(true);
+    window.info.setWid(wid);
+    window.info.setGeometry(geometry);
+    window.desktop = desktop;
+    window.activities = activities;
+
+    m_table[id] = window;
+    m_windows.push_back(wid);
+
+    emit windowAdded(wid);
+
+    return wid;
+}
+
+void SimulatedWindowInterface::removeWindow(WindowId wid)
+{
+    if (!contains(wid)) {
+        return;
+    }
+
+    const WId id = key(wid);
+
+    if (m_activeWindow == id) {
+        setActiveWindow(QVariant::fromValue<WId>(0));
+    }
+
+    m_table.remove(id);
+    m_windows.remove(wid);
+
+    emit windowRemoved(wid);
+}
+
+void SimulatedWindowInterface::moveWindow(WindowId wid, const QRect &geometry)
+{
+    updateWindow(wid, [&geometry](Window & window) {
+        window.info.setGeometry(geometry);
+    });
+}
+
+void SimulatedWindowInterface::setActiveWindow(WindowId wid)
+{
+    const WId id = contains(wid) ? key(wid) : 0;
+
+    if (m_activeWindow == id) {
+        return;
+    }
+
+    if (m_table.contains(m_activeWindow)) {
+        m_table[m_activeWindow].info.setIsActive(false);
+    }
+
+    m_activeWindow = id;
+
+    if (m_table.contains(m_activeWindow)) {
+        Window &window = m_table[m_activeWindow];
+        window.info.setIsActive(true);
+        //! activating a window brings it back as in a real window manager
+        window.info.setIsMinimized(false);
+    }
+
+    emit activeWindowChanged(activeWindow());
+}
+
+void SimulatedWindowInterface::setMinimized(WindowId wid, bool minimized)
+{
+    updateWindow(wid, [minimized](Window & window) {
+        window.info.setIsMinimized(minimized);
+    });
+
+    if (minimized && contains(wid) && m_activeWindow == key(wid)) {
+        setActiveWindow(QVariant::fromValue<WId>(0));
+    }
+}
+
+void SimulatedWindowInterface::setMaximized(WindowId wid, bool maximized)
+{
+    updateWindow(wid, [maximized](Window & window) {
+        window.info.setIsMaxVert(maximized);
+        window.info.setIsMaxHoriz(maximized);
+    });
+}
+
+void SimulatedWindowInterface::setFullscreen(WindowId wid, bool fullscreen)
+{
+    updateWindow(wid, [fullscreen](Window & window) {
+        window.info.setIsFullscreen(fullscreen);
+    });
+}
+
+void SimulatedWindowInterface::setShaded(WindowId wid, bool shaded)
+{
+    updateWindow(wid, [shaded](Window & window) {
+        window.info.setIsShaded(shaded);
+    });
+}
+
+void SimulatedWindowInterface::setWindowKeepAbove(WindowId wid, bool keepAbove)
+{
+    updateWindow(wid, [keepAbove](Window & window) {
+        window.info.setIsKeepAbove(keepAbove);
+    });
+}
+
+void SimulatedWindowInterface::setWindowDesktop(WindowId wid, int desktop)
+{
+    updateWindow(wid, [desktop](Window & window) {
+        window.desktop = desktop;
+    });
+}
+
+void SimulatedWindowInterface::setWindowActivities(WindowId wid, const QStringList &activities)
+{
+    updateWindow(wid, [&activities](Window & window) {
+        window.activities = activities;
+    });
+}
+
+void SimulatedWindowInterface::setCurrentDesktop(int desktop)
+{
+    if (m_currentDesktop == desktop) {
+        return;
+    }
+
+    m_currentDesktop = desktop;
+    emit currentDesktopChanged();
+}
+
+void SimulatedWindowInterface::setCurrentActivity(const QString &activity)
+{
+    if (m_currentActivity == activity) {
+        return;
+    }
+
+    m_currentActivity = activity;
+    emit currentActivityChanged();
+}
+
+void SimulatedWindowInterface::restoreState(Window &window, const WindowInfoWrap &info, bool onCurrentDesktop, bool onCurrentActivity) const
+{
+    const WindowId wid = window.info.wid();
+    const bool active = window.info.isActive();
+
+    window.info = info;
+    window.info.setIsValid(true);
+    window.info.setWid(wid);
+    //! the active window is tracked only through setActiveWindow
+    window.info.setIsActive(active);
+
+    window.desktop = onCurrentDesktop ? 0 : -1;
+    //! an activity that is never going to be the current one
+    window.activities = onCurrentActivity ? QStringList() : QStringList{QStringLiteral("-")};
+}
+
+WindowId SimulatedWindowInterface::restoreWindow(const WindowInfoWrap &info, bool onCurrentDesktop, bool onCurrentActivity)
+{
+    const WId id = m_nextId++;
+    const WindowId wid = QVariant::fromValue<WId>(id);
+
+    Window window;
+    window.info.setWid(wid);
+    restoreState(window, info, onCurrentDesktop, onCurrentActivity);
+
+    m_table[id] = window;
+    m_windows.push_back(wid);
+
+    emit windowAdded(wid);
+
+    return wid;
+}
+
+void SimulatedWindowInterface::setWindowState(WindowId wid, const WindowInfoWrap &info, bool onCurrentDesktop, bool onCurrentActivity, bool notify)
+{
+    if (!contains(wid)) {
+        return;
+    }
+
+    restoreState(m_table[key(wid)], info, onCurrentDesktop, onCurrentActivity);
+
+    //! real window systems announce also changes that are not tracked here
+    //! e.g. title changes, so the recorded changes are always delivered
+    if (notify) {
+        emit windowChanged(wid);
+    }
+}
+
+bool SimulatedWindowInterface::replay(const QString &file, bool maximumSpeed)
+{
+    WindowEventsReplay *replay = new WindowEventsReplay(this, this);
+
+    if (!replay->start(file, maximumSpeed)) {
+        replay->deleteLater();
+        return false;
+    }
+
+    connect(replay, &WindowEventsReplay::finished, this, [this, replay]() {
+        replay->deleteLater();
+        //! the script continues after the replay
+        m_scriptTimer.start(0);
+    });
+
+    return true;
+}
+
+bool SimulatedWindowInterface::runScript(const QString &file)
+{
+    if (WindowEventsReplay::isRecording(file)) {
+        return replay(file);
+    }
+
+    QFile scriptFile(file);
+
+    if (!scriptFile.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        qWarning() << "Simulated window system, script can not be opened :: " << file;
+        return false;
+    }
+
+    QTextStream stream(&scriptFile);
+
+    while (!stream.atEnd()) {
+        m_script << stream.readLine();
+    }
+
+    m_scriptTimer.start(0);
+
+    return true;
+}
+
+void SimulatedWindowInterface::runNextCommand()
+{
+    while (!m_script.isEmpty()) {
+        const int wait = runCommand(m_script.takeFirst());
+
+        if (wait > 0) {
+            m_scriptTimer.start(wait);
+            return;
+        } else if (wait < 0) {
+            return;
+        }
+    }
+
+    emit scriptFinished();
+}
+
+int SimulatedWindowInterface::runCommand(const QString &line)
+{
+    const QStringList args = line.simplified().split(' ', QString::SkipEmptyParts);
+
+    if (args.isEmpty() || args[0].startsWith('#')) {
+        return 0;
+    }
+
+    const QString command = args[0];
+    const WindowId wid = args.count() > 1 ? m_names.value(args[1]) : WindowId();
+
+    auto rect = [&args](int from) {
+        return QRect(args[from].toInt(), args[from + 1].toInt(), args[from + 2].toInt(), args[from + 3].toInt());
+    };
+
+    auto activities = [](const QString &list) {
+        return list == QLatin1String("all") ? QStringList() : list.split(',', QString::SkipEmptyParts);
+    };
+
+    const bool on = args.count() > 2 && args[2] != QLatin1String("off");
+
+    if (command == QLatin1String("create") && args.count() >= 6) {
+        m_names[args[1]] = createWindow(rect(2), args.count() > 6 ? args[6].toInt() : 0
+                                        , args.count() > 7 ? activities(args[7]) : QStringList());
+    } else if (command == QLatin1String("remove") && args.count() >= 2) {
+        removeWindow(wid);
+        m_names.remove(args[1]);
+    } else if (command == QLatin1String("move") && args.count() >= 6) {
+        moveWindow(wid, rect(2));
+    } else if (command == QLatin1String("activate") && args.count() >= 2) {
+        setActiveWindow(wid);
+    } else if (command == QLatin1String("minimize") && args.count() >= 2) {
+        setMinimized(wid, on);
+    } else if (command == QLatin1String("maximize") && args.count() >= 2) {
+        setMaximized(wid, on);
+    } else if (command == QLatin1String("fullscreen") && args.count() >= 2) {
+        setFullscreen(wid, on);
+    } else if (command == QLatin1String("shade") && args.count() >= 2) {
+        setShaded(wid, on);
+    } else if (command == QLatin1String("keepabove") && args.count() >= 2) {
+        setWindowKeepAbove(wid, on);
+    } else if (command == QLatin1String("desktop") && args.count() >= 3) {
+        setWindowDesktop(wid, args[2].toInt());
+    } else if (command == QLatin1String("activities") && args.count() >= 3) {
+        setWindowActivities(wid, activities(args[2]));
+    } else if (command == QLatin1String("current-desktop") && args.count() >= 2) {
+        setCurrentDesktop(args[1].toInt());
+    } else if (command == QLatin1String("current-activity") && args.count() >= 2) {
+        setCurrentActivity(args[1]);
+    } else if (command == QLatin1String("wait") && args.count() >= 2) {
+        return qMax(0, args[1].toInt());
+    } else if (command == QLatin1String("replay") && args.count() >= 2) {
+        if (replay(args[1], args.count() > 2 && args[2] == QLatin1String("max"))) {
+            return -1;
+        }
+    } else {
+        qWarning() << "Simulated window system, unknown command :: " << line;
+    }
+
+    return 0;
+}
+
+}
@@ -0,0 +1,168 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef SIMULATEDWINDOWINTERFACE_H
+#define SIMULATEDWINDOWINTERFACE_H
+
+// local
+#include "abstractwindowinterface.h"
+#include "windowinfowrap.h"
+
+// C++
+#include <functional>
+
+// Qt
+#include <QHash>
+#include <QObject>
+#include <QStringList>
+#include <QTimer>
+
+namespace Latte {
+
+//! A window system that exists only in memory. It is used in order to exercise
+//! the windows tracking, the visibility modes and the positioning of the views
+//! without a display server, e.g. together with the offscreen QPA for
+//! benchmarks and regression tests. Its windows are created and changed
+//! through its public functions or from a script file with one command per line:
+//!
+//!   create <name> <x> <y> <width> <height> [desktop] [activity1,activity2]
+//!   remove <name>
+//!   move <name> <x> <y> <width> <height>
+//!   activate <name>|none
+//!   minimize|maximize|fullscreen|shade|keepabove <name> on|off
+//!   desktop <name> <desktop>            , desktop 0 means all desktops and -1 none
+//!   activities <name> <activity1,activity2>|all
+//!   current-desktop <desktop>
+//!   current-activity <activity>
+//!   wait <msecs>
+//!   replay <recording_file> [max]     , see WindowEventsReplay
+//!
+//! Lines starting with # are ignored
+class SimulatedWindowInterface : public AbstractWindowInterface
+{
+    Q_OBJECT
+
+public:
+    explicit SimulatedWindowInterface(QObject *parent = nullptr);
+    ~SimulatedWindowInterface() override;
+
+    void setViewExtraFlags(QWindow &view) override;
+    void setViewStruts(QWindow &view, const QRect &rect
+                       , Plasma::Types::Location location) override;
+    void setWindowOnActivities(QWindow &window, const QStringList &activities) override;
+
+    void removeViewStruts(QWindow &view) const override;
+
+    WindowId activeWindow() const override;
+    WindowInfoWrap requestInfo(WindowId wid) const override;
+    WindowInfoWrap requestInfoActive() const override;
+    bool isOnCurrentDesktop(WindowId wid) const override;
+    bool isOnCurrentActivity(WindowId wid) const override;
+    const std::list<WindowId> &windows() const override;
+
+    void setKeepAbove(const QDialog &dialog, bool above = true) const override;
+    void skipTaskBar(const QDialog &dialog) const override;
+    void slideWindow(QWindow &view, Slide location) const override;
+    void enableBlurBehind(QWindow &view) const override;
+
+    void releaseMouseEventFor(WindowId wid) const override;
+    void requestToggleMaximized(WindowId wid) const override;
+    void requestMoveWindow(WindowId wid, QPoint from) const override;
+    bool windowCanBeDragged(WindowId wid) const override;
+
+    void setEdgeStateFor(QWindow *view, bool active) const override;
+
+    //! the struts that the views requested, indexed by their window id
+    QHash<WId, QRect> struts() const;
+
+public slots:
+    WindowId createWindow(const QRect &geometry, int desktop = 0, const QStringList &activities = QStringList());
+    void removeWindow(WindowId wid);
+
+    void moveWindow(WindowId wid, const QRect &geometry);
+    void setActiveWindow(WindowId wid);
+
+    void setMinimized(WindowId wid, bool minimized);
+    void setMaximized(WindowId wid, bool maximized);
+    void setFullscreen(WindowId wid, bool fullscreen);
+    void setShaded(WindowId wid, bool shaded);
+    void setWindowKeepAbove(WindowId wid, bool keepAbove);
+
+    void setWindowDesktop(WindowId wid, int desktop);
+    void setWindowActivities(WindowId wid, const QStringList &activities);
+
+    void setCurrentDesktop(int desktop);
+    void setCurrentActivity(const QString &activity);
+
+    //! they are used from replays that know only whether a window is on the
+    //! current desktop/activity instead of the desktop/activities themselves
+    WindowId restoreWindow(const WindowInfoWrap &info, bool onCurrentDesktop, bool onCurrentActivity);
+    void setWindowState(WindowId wid, const WindowInfoWrap &info, bool onCurrentDesktop, bool onCurrentActivity, bool notify = true);
+
+    //! the script commands are executed asynchronously, respecting its waits,
+    //! a recording file of WindowEventsRecorder is also accepted and replayed
+    bool runScript(const QString &file);
+    bool replay(const QString &file, bool maximumSpeed = false);
+
+signals:
+    void scriptFinished();
+
+private slots:
+    void runNextCommand();
+
+private:
+    struct Window {
+        WindowInfoWrap info;
+        //! 0 means on all desktops
+        int desktop{0};
+        //! empty means on all activities
+        QStringList activities;
+    };
+
+    bool contains(WindowId wid) const;
+    WId key(WindowId wid) const;
+
+    void updateWindow(WindowId wid, std::function<void(Window &)> update);
+
+    void restoreState(Window &window, const WindowInfoWrap &info, bool onCurrentDesktop, bool onCurrentActivity) const;
+
+    //! it returns the milliseconds that the script must wait or -1 when
+    //! the script must pause until a replay has finished
+    int runCommand(const QString &line);
+
+private:
+    int m_currentDesktop{1};
+    WId m_activeWindow{0};
+    WId m_nextId{1};
+
+    QString m_currentActivity;
+
+    QHash<WId, Window> m_table;
+    QHash<WId, QRect> m_struts;
+
+    //! script state
+    QStringList m_script;
+    QHash<QString, WindowId> m_names;
+    QTimer m_scriptTimer;
+};
+
+}
+
+#endif // SIMULATEDWINDOWINTERFACE_H
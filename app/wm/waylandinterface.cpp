@@ -25,6 +25,7 @@
 #include "view/view.h"
 #include "../lattecorona.h"
 #include "../liblatte2/extras.h"
+#include "../liblatte2/statistics.h"
 
 // Qt
 #include <QDebug>
@@ -326,6 +327,8 @@ bool WaylandInterface::isOnCurrentActivity(WindowId wid) const
 
 WindowInfoWrap WaylandInterface::requestInfo(WindowId wid) const
 {
+    LATTE_COUNT(RequestInfoCalls);
+
     WindowInfoWrap winfoWrap;
 
     auto w = windowFor(wid);
@@ -456,8 +459,10 @@ void WaylandInterface::windowCreatedProxy(KWayland::Client::PlasmaWindow *w)
     , this, [&](QObject * w) noexcept {
         //qDebug() << "window changed:" << qobject_cast<PlasmaWindow *>(w)->appId();
         PlasmaWindow *pW = qobject_cast<PlasmaWindow*>(w);
+        LATTE_COUNT(WindowEventsReceived);
 
         if (pW && !isPlasmaDesktop(pW) && pW->appId() != QLatin1String("latte-dock")) {
+            LATTE_COUNT(WindowEventsDelivered);
             emit windowChanged(pW->internalId());
         }
     });
@@ -0,0 +1,157 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "windoweventsrecorder.h"
+
+// local
+#include "abstractwindowinterface.h"
+
+// Qt
+#include <QDebug>
+
+namespace Latte {
+
+WindowEventsRecorder::WindowEventsRecorder(AbstractWindowInterface *wm, const QString &file, QObject *parent)
+    : QObject(parent),
+      m_wm(wm),
+      m_file(file)
+{
+    if (!m_wm || !m_file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qWarning() << "Window events recorder, file can not be opened :: " << file;
+        return;
+    }
+
+    m_stream.setDevice(&m_file);
+    m_stream.setVersion(QDataStream::Qt_5_6);
+    m_stream << Magic << Version;
+
+    m_timer.start();
+
+    //! the windows that already exist when the recording starts
+    for (const auto &wid : m_wm->windows()) {
+        writeWindow(WindowAdded, wid);
+    }
+
+    writeWindow(ActiveWindowChanged, m_wm->activeWindow());
+
+    connect(m_wm, &AbstractWindowInterface::windowAdded, this, [this](WindowId wid) {
+        writeWindow(WindowAdded, wid);
+    });
+    connect(m_wm, &AbstractWindowInterface::windowChanged, this, [this](WindowId wid) {
+        writeWindow(WindowChanged, wid);
+    });
+    connect(m_wm, &AbstractWindowInterface::windowRemoved, this, [this](WindowId wid) {
+        writeWindow(WindowRemoved, wid);
+    });
+    connect(m_wm, &AbstractWindowInterface::activeWindowChanged, this, [this](WindowId wid) {
+        writeWindow(ActiveWindowChanged, wid);
+    });
+    connect(m_wm, &AbstractWindowInterface::currentDesktopChanged, this, [this]() {
+        writeAllWindowStates();
+        writeEvent(CurrentDesktopChanged);
+    });
+    connect(m_wm, &AbstractWindowInterface::currentActivityChanged, this, [this]() {
+        writeAllWindowStates();
+        writeEvent(CurrentActivityChanged);
+    });
+
+    qDebug() << "Window events recorder, recording to :: " << file;
+}
+
+WindowEventsRecorder::~WindowEventsRecorder()
+{
+    if (m_file.isOpen()) {
+        m_file.close();
+    }
+}
+
+bool WindowEventsRecorder::isRecording() const
+{
+    return m_file.isOpen();
+}
+
+quint16 WindowEventsRecorder::stateFlags(const WindowInfoWrap &info, bool onCurrentDesktop, bool onCurrentActivity)
+{
+    quint16 flags = 0;
+
+    flags |= info.isActive() ? Active : 0;
+    flags |= info.isMinimized() ? Minimized : 0;
+    flags |= info.isMaxVert() ? MaxVert : 0;
+    flags |= info.isMaxHoriz() ? MaxHoriz : 0;
+    flags |= info.isFullscreen() ? Fullscreen : 0;
+    flags |= info.isShaded() ? Shaded : 0;
+    flags |= info.isKeepAbove() ? KeepAbove : 0;
+    flags |= info.hasSkipTaskbar() ? SkipTaskbar : 0;
+    flags |= info.isPlasmaDesktop() ? PlasmaDesktop : 0;
+    flags |= onCurrentDesktop ? OnCurrentDesktop : 0;
+    flags |= onCurrentActivity ? OnCurrentActivity : 0;
+
+    return flags;
+}
+
+void WindowEventsRecorder::applyStateFlags(WindowInfoWrap &info, quint16 flags)
+{
+    info.setIsActive(flags & Active);
+    info.setIsMinimized(flags & Minimized);
+    info.setIsMaxVert(flags & MaxVert);
+    info.setIsMaxHoriz(flags & MaxHoriz);
+    info.setIsFullscreen(flags & Fullscreen);
+    info.setIsShaded(flags & Shaded);
+    info.setIsKeepAbove(flags & KeepAbove);
+    info.setHasSkipTaskbar(flags & SkipTaskbar);
+    info.setIsPlasmaDesktop(flags & PlasmaDesktop);
+}
+
+void WindowEventsRecorder::writeEvent(EventType type)
+{
+    if (!m_file.isOpen()) {
+        return;
+    }
+
+    m_stream << quint32(m_timer.elapsed()) << quint8(type);
+}
+
+void WindowEventsRecorder::writeWindow(EventType type, WindowId wid)
+{
+    if (!m_file.isOpen()) {
+        return;
+    }
+
+    writeEvent(type);
+    m_stream << quint64(wid.value<WId>());
+
+    if (type == WindowRemoved || type == ActiveWindowChanged) {
+        return;
+    }
+
+    WindowInfoWrap info = m_wm->requestInfo(wid);
+
+    m_stream << info.geometry()
+             << stateFlags(info, m_wm->isOnCurrentDesktop(wid), m_wm->isOnCurrentActivity(wid));
+}
+
+void WindowEventsRecorder::writeAllWindowStates()
+{
+    for (const auto &wid : m_wm->windows()) {
+        writeWindow(WindowState, wid);
+    }
+}
+
+}
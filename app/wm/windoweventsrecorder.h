@@ -0,0 +1,110 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef WINDOWEVENTSRECORDER_H
+#define WINDOWEVENTSRECORDER_H
+
+// local
+#include "windowinfowrap.h"
+
+// Qt
+#include <QDataStream>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QObject>
+#include <QPointer>
+
+namespace Latte {
+class AbstractWindowInterface;
+}
+
+namespace Latte {
+
+//! It records the events that a window system delivers to the views into a
+//! compact binary file. The file can be replayed afterwards through the
+//! simulated window system, see WindowEventsReplay, so issues that depend on
+//! the exact event stream of a session can be reproduced and measured.
+//!
+//! File format, QDataStream Qt_5_6:
+//!   header: quint32 magic, quint16 version
+//!   event:  quint32 msecs since the recording started, quint8 EventType, payload
+//!           WindowAdded/WindowChanged/WindowState: quint64 wid, QRect geometry, quint16 StateFlags
+//!           WindowRemoved/ActiveWindowChanged: quint64 wid
+//!           CurrentDesktopChanged/CurrentActivityChanged: no payload, they are preceded by
+//!           WindowState events for all windows
+class WindowEventsRecorder : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum EventType : quint8
+    {
+        WindowAdded = 0,
+        WindowChanged,
+        WindowRemoved,
+        ActiveWindowChanged,
+        CurrentDesktopChanged,
+        CurrentActivityChanged,
+        //! a window snapshot that must be applied silently
+        WindowState
+    };
+
+    enum StateFlag : quint16
+    {
+        Active = 1 << 0,
+        Minimized = 1 << 1,
+        MaxVert = 1 << 2,
+        MaxHoriz = 1 << 3,
+        Fullscreen = 1 << 4,
+        Shaded = 1 << 5,
+        KeepAbove = 1 << 6,
+        SkipTaskbar = 1 << 7,
+        PlasmaDesktop = 1 << 8,
+        OnCurrentDesktop = 1 << 9,
+        OnCurrentActivity = 1 << 10
+    };
+
+    static const quint32 Magic = 0x4C574D52; //! "LWMR"
+    static const quint16 Version = 1;
+
+    WindowEventsRecorder(AbstractWindowInterface *wm, const QString &file, QObject *parent = nullptr);
+    ~WindowEventsRecorder() override;
+
+    bool isRecording() const;
+
+    static quint16 stateFlags(const WindowInfoWrap &info, bool onCurrentDesktop, bool onCurrentActivity);
+    static void applyStateFlags(WindowInfoWrap &info, quint16 flags);
+
+private:
+    void writeEvent(EventType type);
+    void writeWindow(EventType type, WindowId wid);
+    void writeAllWindowStates();
+
+private:
+    QPointer<AbstractWindowInterface> m_wm;
+
+    QFile m_file;
+    QDataStream m_stream;
+    QElapsedTimer m_timer;
+};
+
+}
+
+#endif // WINDOWEVENTSRECORDER_H
@@ -0,0 +1,233 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "windoweventsreplay.h"
+
+// local
+#include "simulatedwindowinterface.h"
+
+// Qt
+#include <QDebug>
+#include <QFile>
+
+namespace Latte {
+
+WindowEventsReplay::WindowEventsReplay(SimulatedWindowInterface *wm, QObject *parent)
+    : QObject(parent),
+      m_wm(wm)
+{
+    m_timer.setSingleShot(true);
+    connect(&m_timer, &QTimer::timeout, this, &WindowEventsReplay::replayNext);
+}
+
+WindowEventsReplay::~WindowEventsReplay()
+{
+    m_timer.stop();
+}
+
+bool WindowEventsReplay::isRecording(const QString &file)
+{
+    QFile recording(file);
+
+    if (!recording.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    QDataStream stream(&recording);
+    stream.setVersion(QDataStream::Qt_5_6);
+
+    quint32 magic{0};
+    stream >> magic;
+
+    return magic == WindowEventsRecorder::Magic;
+}
+
+bool WindowEventsReplay::start(const QString &file, bool maximumSpeed)
+{
+    QFile recording(file);
+
+    if (!m_wm || !recording.open(QIODevice::ReadOnly)) {
+        qWarning() << "Window events replay, file can not be opened :: " << file;
+        return false;
+    }
+
+    QDataStream stream(&recording);
+    stream.setVersion(QDataStream::Qt_5_6);
+
+    quint32 magic{0};
+    quint16 version{0};
+    stream >> magic >> version;
+
+    if (magic != WindowEventsRecorder::Magic || version > WindowEventsRecorder::Version) {
+        qWarning() << "Window events replay, unsupported file :: " << file;
+        return false;
+    }
+
+    m_events.clear();
+
+    while (!stream.atEnd() && stream.status() == QDataStream::Ok) {
+        Event event;
+        stream >> event.msecs >> event.type;
+
+        if (event.type != WindowEventsRecorder::CurrentDesktopChanged
+            && event.type != WindowEventsRecorder::CurrentActivityChanged) {
+            stream >> event.wid;
+        }
+
+        if (event.type == WindowEventsRecorder::WindowAdded
+            || event.type == WindowEventsRecorder::WindowChanged
+            || event.type == WindowEventsRecorder::WindowState) {
+            stream >> event.geometry >> event.flags;
+        }
+
+        if (stream.status() == QDataStream::Ok) {
+            m_events << event;
+        }
+    }
+
+    qDebug() << "Window events replay, events loaded :: " << m_events.count() << " from :: " << file;
+
+    m_maximumSpeed = maximumSpeed;
+    m_next = 0;
+    m_costs.clear();
+    m_clock.start();
+
+    scheduleNext();
+
+    return true;
+}
+
+void WindowEventsReplay::scheduleNext()
+{
+    if (m_next >= m_events.count()) {
+        qInfo().noquote() << report();
+        emit finished();
+        return;
+    }
+
+    //! even at maximum speed the event loop runs between the events, so the
+    //! work that the receivers postpone is also taking place
+    const qint64 wait = m_maximumSpeed ? 0 : m_events[m_next].msecs - m_clock.elapsed();
+    m_timer.start(static_cast<int>(qMax(qint64(0), wait)));
+}
+
+void WindowEventsReplay::replayNext()
+{
+    if (!m_wm) {
+        return;
+    }
+
+    //! all the events that are already due are applied together
+    do {
+        apply(m_events[m_next]);
+        m_next++;
+    } while (!m_maximumSpeed && m_next < m_events.count() && m_events[m_next].msecs <= m_clock.elapsed());
+
+    scheduleNext();
+}
+
+void WindowEventsReplay::apply(const Event &event)
+{
+    WindowInfoWrap info;
+    info.setGeometry(event.geometry);
+    WindowEventsRecorder::applyStateFlags(info, event.flags);
+
+    const bool onCurrentDesktop = event.flags & WindowEventsRecorder::OnCurrentDesktop;
+    const bool onCurrentActivity = event.flags & WindowEventsRecorder::OnCurrentActivity;
+
+    QElapsedTimer cost;
+    cost.start();
+
+    switch (event.type) {
+        case WindowEventsRecorder::WindowAdded:
+            if (!m_windows.contains(event.wid)) {
+                m_windows[event.wid] = m_wm->restoreWindow(info, onCurrentDesktop, onCurrentActivity);
+            }
+
+            break;
+
+        case WindowEventsRecorder::WindowChanged:
+        case WindowEventsRecorder::WindowState:
+            if (m_windows.contains(event.wid)) {
+                m_wm->setWindowState(m_windows[event.wid], info, onCurrentDesktop, onCurrentActivity
+                                     , event.type == WindowEventsRecorder::WindowChanged);
+            }
+
+            break;
+
+        case WindowEventsRecorder::WindowRemoved:
+            if (m_windows.contains(event.wid)) {
+                m_wm->removeWindow(m_windows.take(event.wid));
+            }
+
+            break;
+
+        case WindowEventsRecorder::ActiveWindowChanged:
+            m_wm->setActiveWindow(m_windows.value(event.wid, QVariant::fromValue<WId>(0)));
+            break;
+
+        //! the window memberships have already been updated from the WindowState events,
+        //! only the change needs to be announced
+        case WindowEventsRecorder::CurrentDesktopChanged:
+            m_wm->setCurrentDesktop(++m_desktopCounter);
+            break;
+
+        case WindowEventsRecorder::CurrentActivityChanged:
+            m_wm->setCurrentActivity(QString::number(++m_activityCounter));
+            break;
+
+        default:
+            break;
+    }
+
+    const qint64 nsecs = cost.nsecsElapsed();
+
+    Cost &typeCost = m_costs[event.type];
+    typeCost.count++;
+    typeCost.totalNsecs += nsecs;
+    typeCost.maxNsecs = qMax(typeCost.maxNsecs, nsecs);
+}
+
+QString WindowEventsReplay::report() const
+{
+    static const QStringList names{"window added", "window changed", "window removed", "active window changed"
+                                   , "desktop changed", "activity changed", "window state"};
+
+    QString table = QStringLiteral("Window events replay, processing cost per event type\n");
+    table += QStringLiteral("%1 %2 %3 %4 %5\n").arg("event", -24).arg("count", 8).arg("total ms", 12)
+             .arg("mean us", 12).arg("max us", 12);
+
+    for (int type = 0; type < names.count(); ++type) {
+        if (!m_costs.contains(type)) {
+            continue;
+        }
+
+        const Cost cost = m_costs.value(type);
+
+        table += QStringLiteral("%1 %2 %3 %4 %5\n").arg(names[type], -24).arg(cost.count, 8)
+                 .arg(cost.totalNsecs / 1000000.0, 12, 'f', 3)
+                 .arg(cost.totalNsecs / 1000.0 / cost.count, 12, 'f', 1)
+                 .arg(cost.maxNsecs / 1000.0, 12, 'f', 1);
+    }
+
+    return table;
+}
+
+}
@@ -0,0 +1,105 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef WINDOWEVENTSREPLAY_H
+#define WINDOWEVENTSREPLAY_H
+
+// local
+#include "windoweventsrecorder.h"
+
+// Qt
+#include <QElapsedTimer>
+#include <QHash>
+#include <QObject>
+#include <QPointer>
+#include <QTimer>
+#include <QVector>
+
+namespace Latte {
+class SimulatedWindowInterface;
+}
+
+namespace Latte {
+
+//! It feeds a recording of WindowEventsRecorder back through the simulated
+//! window system, either respecting the original timing or as fast as the
+//! event loop allows. The synchronous processing cost of every event, i.e.
+//! the time spent in all the receivers of the emitted signal, is measured
+//! and reported per event type when the replay finishes.
+class WindowEventsReplay : public QObject
+{
+    Q_OBJECT
+
+public:
+    WindowEventsReplay(SimulatedWindowInterface *wm, QObject *parent = nullptr);
+    ~WindowEventsReplay() override;
+
+    static bool isRecording(const QString &file);
+
+    bool start(const QString &file, bool maximumSpeed = false);
+
+    //! a human readable table of the processing costs
+    QString report() const;
+
+signals:
+    void finished();
+
+private slots:
+    void replayNext();
+
+private:
+    struct Event {
+        quint32 msecs{0};
+        quint8 type{0};
+        quint64 wid{0};
+        QRect geometry;
+        quint16 flags{0};
+    };
+
+    struct Cost {
+        int count{0};
+        qint64 totalNsecs{0};
+        qint64 maxNsecs{0};
+    };
+
+    void apply(const Event &event);
+    void scheduleNext();
+
+private:
+    bool m_maximumSpeed{false};
+    int m_next{0};
+
+    //! they are used in order to announce desktop/activity changes
+    int m_desktopCounter{1};
+    int m_activityCounter{0};
+
+    QPointer<SimulatedWindowInterface> m_wm;
+
+    QVector<Event> m_events;
+    QHash<quint64, WindowId> m_windows;
+    QHash<quint8, Cost> m_costs;
+
+    QElapsedTimer m_clock;
+    QTimer m_timer;
+};
+
+}
+
+#endif // WINDOWEVENTSREPLAY_H
@@ -24,6 +24,7 @@
 #include "view/screenedgeghostwindow.h"
 #include "view/view.h"
 #include "../liblatte2/extras.h"
+#include "../liblatte2/statistics.h"
 
 // Qt
 #include <QDebug>
@@ -298,6 +299,8 @@ bool XWindowInterface::isOnCurrentActivity(WindowId wid) const
 
 WindowInfoWrap XWindowInterface::requestInfo(WindowId wid) const
 {
+    LATTE_COUNT(RequestInfoCalls);
+
     const KWindowInfo winfo{wid.value<WId>(), NET::WMFrameExtents
                             | NET::WMWindowType
                             | NET::WMGeometry
@@ -422,6 +425,8 @@ bool XWindowInterface::isValidWindow(const KWindowInfo &winfo) const
 
 void XWindowInterface::windowChangedProxy(WId wid, NET::Properties prop1, NET::Properties2 prop2)
 {
+    LATTE_COUNT(WindowEventsReceived);
+
     //! if the view changed is ignored
     if (std::find(m_views.cbegin(), m_views.cend(), wid) != m_views.cend())
         return;
@@ -437,6 +442,7 @@ void XWindowInterface::windowChangedProxy(WId wid, NET::Properties prop1, NET::P
     //! update desktop id
     if (winType != -1 && (winType & NET::Desktop)) {
         m_desktopId = wid;
+        LATTE_COUNT(WindowEventsDelivered);
         emit windowChanged(wid);
         return;
     }
@@ -469,6 +475,7 @@ void XWindowInterface::windowChangedProxy(WId wid, NET::Properties prop1, NET::P
         }
     }
 
+    LATTE_COUNT(WindowEventsDelivered);
     emit windowChanged(wid);
 }
 
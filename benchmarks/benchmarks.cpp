@@ -0,0 +1,158 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "benchmarks.h"
+
+// local
+#include "../liblatte2/iconitem.h"
+#include "../liblatte2/plasma/extended/backgroundcache.h"
+
+// Qt
+#include <QFile>
+#include <QImage>
+#include <QLinearGradient>
+#include <QLoggingCategory>
+#include <QPainter>
+#include <QRadialGradient>
+#include <QtTest>
+
+// Plasma
+#include <Plasma>
+
+namespace Latte {
+
+void Benchmarks::initTestCase()
+{
+    QVERIFY(m_wallpapersDir.isValid());
+
+    //! BackgroundCache reports every calculation through qDebug
+    QLoggingCategory::setFilterRules(QStringLiteral("default.debug=false"));
+}
+
+//! a wallpaper with light and dark areas along its edges, so the busy
+//! detection has to walk all of its sub areas
+QString Benchmarks::wallpaperFile(int width, int height)
+{
+    QString file = m_wallpapersDir.filePath(QStringLiteral("%1x%2.png").arg(width).arg(height));
+
+    if (QFile::exists(file)) {
+        return file;
+    }
+
+    QImage wallpaper(width, height, QImage::Format_ARGB32);
+    QPainter painter(&wallpaper);
+
+    QLinearGradient gradient(0, 0, width, height);
+    gradient.setColorAt(0.0, QColor(20, 40, 90));
+    gradient.setColorAt(0.5, QColor(230, 200, 120));
+    gradient.setColorAt(1.0, QColor(10, 10, 10));
+    painter.fillRect(wallpaper.rect(), gradient);
+
+    int stripe = width / 10;
+
+    for (int i = 0; i < 10; i += 2) {
+        painter.fillRect(i * stripe, 0, stripe, height, QColor(255, 255, 255, 90));
+    }
+
+    painter.end();
+
+    if (!wallpaper.save(file)) {
+        return QString();
+    }
+
+    return file;
+}
+
+void Benchmarks::backgroundCacheImageCalculations_data()
+{
+    QTest::addColumn<int>("width");
+    QTest::addColumn<int>("height");
+    QTest::addColumn<int>("edge");
+
+    QTest::newRow("1080p bottom") << 1920 << 1080 << static_cast<int>(Plasma::Types::BottomEdge);
+    QTest::newRow("1080p left") << 1920 << 1080 << static_cast<int>(Plasma::Types::LeftEdge);
+    QTest::newRow("4K bottom") << 3840 << 2160 << static_cast<int>(Plasma::Types::BottomEdge);
+    QTest::newRow("4K left") << 3840 << 2160 << static_cast<int>(Plasma::Types::LeftEdge);
+    QTest::newRow("8K bottom") << 7680 << 4320 << static_cast<int>(Plasma::Types::BottomEdge);
+    QTest::newRow("8K left") << 7680 << 4320 << static_cast<int>(Plasma::Types::LeftEdge);
+}
+
+void Benchmarks::backgroundCacheImageCalculations()
+{
+    QFETCH(int, width);
+    QFETCH(int, height);
+    QFETCH(int, edge);
+    Plasma::Types::Location location = static_cast<Plasma::Types::Location>(edge);
+
+    QString file = wallpaperFile(width, height);
+    QVERIFY(!file.isEmpty());
+
+    PlasmaExtended::BackgroundCache *cache = PlasmaExtended::BackgroundCache::self();
+
+    //! every iteration is a cache miss, it loads the image and analyzes the edge
+    QBENCHMARK {
+        cache->m_hintsCache.remove(file);
+        cache->updateImageCalculations(file, location);
+    }
+
+    QVERIFY(cache->m_hintsCache.contains(file));
+    QVERIFY(cache->m_hintsCache[file].contains(location));
+}
+
+void Benchmarks::iconItemUpdateColors_data()
+{
+    QTest::addColumn<int>("size");
+
+    QTest::newRow("16px") << 16;
+    QTest::newRow("48px") << 48;
+    QTest::newRow("128px") << 128;
+    QTest::newRow("256px") << 256;
+}
+
+void Benchmarks::iconItemUpdateColors()
+{
+    QFETCH(int, size);
+
+    QImage icon(size, size, QImage::Format_ARGB32_Premultiplied);
+    icon.fill(Qt::transparent);
+
+    QPainter painter(&icon);
+    QRadialGradient gradient(size / 2, size / 2, size / 2);
+    gradient.setColorAt(0.0, QColor(240, 120, 30));
+    gradient.setColorAt(0.7, QColor(40, 140, 220));
+    gradient.setColorAt(1.0, Qt::transparent);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setBrush(gradient);
+    painter.setPen(Qt::NoPen);
+    painter.drawEllipse(icon.rect());
+    painter.end();
+
+    IconItem item;
+    item.m_iconPixmap = QPixmap::fromImage(icon);
+
+    QBENCHMARK {
+        item.updateColors();
+    }
+
+    QVERIFY(item.backgroundColor().isValid());
+    QVERIFY(item.glowColor().isValid());
+}
+
+}
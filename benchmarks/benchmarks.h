@@ -0,0 +1,54 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef BENCHMARKS_H
+#define BENCHMARKS_H
+
+// Qt
+#include <QObject>
+#include <QTemporaryDir>
+
+namespace Latte {
+
+//! hot paths of the qml plugin that run on the gui thread and grow with
+//! the size of their input, measured through QBENCHMARK
+class Benchmarks : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+
+    void backgroundCacheImageCalculations_data();
+    void backgroundCacheImageCalculations();
+
+    void iconItemUpdateColors_data();
+    void iconItemUpdateColors();
+
+private:
+    QString wallpaperFile(int width, int height);
+
+private:
+    QTemporaryDir m_wallpapersDir;
+};
+
+}
+
+#endif
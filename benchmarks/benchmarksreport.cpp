@@ -0,0 +1,137 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "benchmarksreport.h"
+
+// local
+#include "config-latte.h"
+
+// Qt
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSysInfo>
+#include <QTemporaryFile>
+#include <QXmlStreamReader>
+#include <QtTest>
+
+namespace {
+const char JsonOption[] = "--json";
+
+//! the results of the xml log as json objects
+QJsonArray benchmarkResults(QFile &xmlLog)
+{
+    QJsonArray results;
+    QString function;
+    QXmlStreamReader reader(&xmlLog);
+
+    while (!reader.atEnd()) {
+        reader.readNext();
+
+        if (!reader.isStartElement()) {
+            continue;
+        }
+
+        if (reader.name() == QLatin1String("TestFunction")) {
+            function = reader.attributes().value(QLatin1String("name")).toString();
+        } else if (reader.name() == QLatin1String("BenchmarkResult")) {
+            const QXmlStreamAttributes attributes = reader.attributes();
+            const double value = attributes.value(QLatin1String("value")).toDouble();
+            const int iterations = attributes.value(QLatin1String("iterations")).toInt();
+
+            QJsonObject result;
+            result[QStringLiteral("name")] = function;
+            result[QStringLiteral("tag")] = attributes.value(QLatin1String("tag")).toString();
+            result[QStringLiteral("metric")] = attributes.value(QLatin1String("metric")).toString();
+            result[QStringLiteral("iterations")] = iterations;
+            //! QBENCHMARK already reports the value of a single iteration
+            result[QStringLiteral("value")] = value;
+
+            results.append(result);
+        }
+    }
+
+    if (reader.hasError()) {
+        qWarning() << "Benchmarks xml log could not be parsed:" << reader.errorString();
+    }
+
+    return results;
+}
+}
+
+namespace Latte {
+
+int execBenchmarks(QObject *benchmarks, QStringList arguments, const QString &defaultJsonFile)
+{
+    QString jsonFile = defaultJsonFile;
+
+    int jsonIndex = arguments.indexOf(QLatin1String(JsonOption));
+
+    if (jsonIndex > 0 && jsonIndex + 1 < arguments.count()) {
+        jsonFile = arguments.at(jsonIndex + 1);
+        arguments.removeAt(jsonIndex + 1);
+        arguments.removeAt(jsonIndex);
+    }
+
+    QTemporaryFile xmlLog(QDir::tempPath() + QStringLiteral("/latte-benchmarks-XXXXXX.xml"));
+
+    if (!xmlLog.open()) {
+        qWarning() << "Benchmarks xml log could not be created:" << xmlLog.fileName();
+        return 1;
+    }
+
+    xmlLog.close();
+
+    arguments << QStringLiteral("-o") << xmlLog.fileName() + QStringLiteral(",xml")
+              << QStringLiteral("-o") << QStringLiteral("-,txt");
+
+    int failures = QTest::qExec(benchmarks, arguments);
+
+    if (!xmlLog.open()) {
+        qWarning() << "Benchmarks xml log could not be read:" << xmlLog.fileName();
+        return 1;
+    }
+
+    QJsonObject report;
+    report[QStringLiteral("version")] = QStringLiteral(VERSION);
+    report[QStringLiteral("date")] = QDateTime::currentDateTimeUtc().toString(Qt::ISODate);
+    report[QStringLiteral("platform")] = QSysInfo::prettyProductName();
+    report[QStringLiteral("cpu")] = QSysInfo::currentCpuArchitecture();
+    report[QStringLiteral("benchmarks")] = benchmarkResults(xmlLog);
+
+    QFile output(jsonFile);
+
+    if (!output.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qWarning() << "Benchmarks report could not be written:" << jsonFile;
+        return 1;
+    }
+
+    output.write(QJsonDocument(report).toJson());
+    output.close();
+
+    qInfo() << "Benchmarks report written to:" << jsonFile;
+
+    return failures;
+}
+
+}
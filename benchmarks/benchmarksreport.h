@@ -0,0 +1,37 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef BENCHMARKSREPORT_H
+#define BENCHMARKSREPORT_H
+
+// Qt
+#include <QObject>
+#include <QStringList>
+
+namespace Latte {
+
+//! executes the QBENCHMARK functions of benchmarks and writes their results
+//! as JSON, QtTest has no json logger so they are read back from its xml log.
+//! arguments: [--json file_name] [QtTest options] [functions...]
+int execBenchmarks(QObject *benchmarks, QStringList arguments, const QString &defaultJsonFile);
+
+}
+
+#endif
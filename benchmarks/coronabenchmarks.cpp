@@ -0,0 +1,186 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "coronabenchmarks.h"
+
+// local
+#include "../app/lattecorona.h"
+#include "../app/layoutmanager.h"
+#include "../app/screenpool.h"
+#include "../app/layout/layout.h"
+#include "../app/view/view.h"
+#include "../app/view/windowstracker.h"
+#include "../app/wm/simulatedwindowinterface.h"
+#include "../liblatte2/types.h"
+
+// Qt
+#include <QFile>
+#include <QLoggingCategory>
+#include <QScreen>
+#include <QtTest>
+
+namespace Latte {
+
+void CoronaBenchmarks::initTestCase()
+{
+    QVERIFY(m_scriptDir.isValid());
+
+    //! the corona, the layouts and the views report every step through qDebug
+    QLoggingCategory::setFilterRules(QStringLiteral("default.debug=false"));
+
+    //! the windows are created from the benchmarks themselves, the script
+    //! only selects the simulated window system
+    QString script = m_scriptDir.filePath(QStringLiteral("windows.txt"));
+    QFile scriptFile(script);
+    QVERIFY(scriptFile.open(QIODevice::WriteOnly));
+    scriptFile.write("# the windows are created through the SimulatedWindowInterface api\n");
+    scriptFile.close();
+
+    m_corona = new Latte::Corona(true, QString(), static_cast<int>(Types::SingleLayout), script);
+
+    if (!m_corona->kPackage().isValid()) {
+        QSKIP("the Latte shell package is not installed");
+    }
+
+    m_wm = qobject_cast<Latte::SimulatedWindowInterface *>(m_corona->wm());
+    QVERIFY(m_wm);
+
+    QTRY_VERIFY_WITH_TIMEOUT(m_corona->layoutManager()->currentLayout(), 10000);
+    m_layout = m_corona->layoutManager()->currentLayout();
+
+    QTRY_VERIFY_WITH_TIMEOUT(!m_layout->latteViews()->isEmpty(), 10000);
+    m_view = m_layout->latteViews()->values().first();
+}
+
+void CoronaBenchmarks::cleanupTestCase()
+{
+    removeWindows();
+
+    delete m_corona;
+    m_corona = nullptr;
+}
+
+//! half of the windows touch the bottom edge, one of them is active and
+//! another one is maximized, the rest are spread over the screen
+void CoronaBenchmarks::createWindows(int count)
+{
+    QRect screen = m_view->screen()->geometry();
+
+    for (int i = 0; i < count; ++i) {
+        int width = screen.width() / 4;
+        int height = screen.height() / 4;
+        int x = screen.x() + (i * 37) % (screen.width() - width);
+        int y = (i % 2 == 0) ? screen.bottom() - height + 1 : screen.y() + (i * 23) % (screen.height() / 2);
+
+        m_windows << m_wm->createWindow(QRect(x, y, width, height));
+    }
+
+    if (count > 1) {
+        m_wm->moveWindow(m_windows.at(1), screen);
+        m_wm->setMaximized(m_windows.at(1), true);
+    }
+
+    if (count > 0) {
+        m_wm->setActiveWindow(m_windows.at(0));
+    }
+}
+
+void CoronaBenchmarks::removeWindows()
+{
+    if (!m_wm) {
+        return;
+    }
+
+    for (const auto &wid : m_windows) {
+        m_wm->removeWindow(wid);
+    }
+
+    m_windows.clear();
+}
+
+void CoronaBenchmarks::layoutNewUniqueIdsLayoutFromFile()
+{
+    QString file = m_layout->file();
+    QVERIFY(QFile::exists(file));
+
+    QString newFile;
+
+    //! every iteration reassigns all the containments and applets ids of
+    //! the layout file against the ids of the loaded corona
+    QBENCHMARK {
+        newFile = m_layout->newUniqueIdsLayoutFromFile(file);
+    }
+
+    QVERIFY(QFile::exists(newFile));
+}
+
+void CoronaBenchmarks::coronaAvailableScreenRegionWithCriteria_data()
+{
+    QTest::addColumn<bool>("namedLayout");
+
+    QTest::newRow("current layout") << false;
+    QTest::newRow("named layout") << true;
+}
+
+void CoronaBenchmarks::coronaAvailableScreenRegionWithCriteria()
+{
+    QFETCH(bool, namedLayout);
+
+    int screenId = m_corona->screenPool()->primaryScreenId();
+    QString layoutName = namedLayout ? m_layout->name() : QString();
+
+    QRegion region;
+
+    QBENCHMARK {
+        region = m_corona->availableScreenRegionWithCriteria(screenId, layoutName);
+    }
+
+    QVERIFY(!region.isEmpty());
+}
+
+void CoronaBenchmarks::windowsTrackerUpdateFlags_data()
+{
+    QTest::addColumn<int>("windows");
+
+    QTest::newRow("10 windows") << 10;
+    QTest::newRow("100 windows") << 100;
+    QTest::newRow("500 windows") << 500;
+}
+
+void CoronaBenchmarks::windowsTrackerUpdateFlags()
+{
+    QFETCH(int, windows);
+
+    ViewPart::WindowsTracker *tracker = m_view->windowsTracker();
+    tracker->setEnabled(true);
+
+    createWindows(windows);
+    QCoreApplication::processEvents();
+
+    QBENCHMARK {
+        tracker->updateFlags();
+    }
+
+    QVERIFY(tracker->existsWindowMaximized());
+
+    removeWindows();
+}
+
+}
@@ -0,0 +1,78 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef CORONABENCHMARKS_H
+#define CORONABENCHMARKS_H
+
+// local
+#include "../app/wm/windowinfowrap.h"
+
+// Qt
+#include <QList>
+#include <QObject>
+#include <QTemporaryDir>
+
+namespace Latte {
+class Corona;
+class Layout;
+class SimulatedWindowInterface;
+class View;
+}
+
+namespace Latte {
+
+//! hot paths of the application that need a running Corona. The default
+//! layout is loaded with its views offscreen and the windows are provided
+//! from the simulated window system, so neither a display server nor a
+//! window manager is needed. The Latte shell package must be installed
+class CoronaBenchmarks : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void layoutNewUniqueIdsLayoutFromFile();
+
+    void coronaAvailableScreenRegionWithCriteria_data();
+    void coronaAvailableScreenRegionWithCriteria();
+
+    void windowsTrackerUpdateFlags_data();
+    void windowsTrackerUpdateFlags();
+
+private:
+    void createWindows(int count);
+    void removeWindows();
+
+private:
+    QTemporaryDir m_scriptDir;
+
+    QList<WindowId> m_windows;
+
+    Latte::Corona *m_corona{nullptr};
+    Latte::Layout *m_layout{nullptr};
+    Latte::View *m_view{nullptr};
+    Latte::SimulatedWindowInterface *m_wm{nullptr};
+};
+
+}
+
+#endif
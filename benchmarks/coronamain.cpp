@@ -0,0 +1,67 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+// local
+#include "benchmarksreport.h"
+#include "coronabenchmarks.h"
+
+// Qt
+#include <QApplication>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QQuickWindow>
+#include <QTemporaryDir>
+
+//! usage: latte-corona-benchmarks [--json file_name] [QtTest options] [functions...]
+//! The results are always written as JSON, by default to latte-corona-benchmarks.json
+int main(int argc, char **argv)
+{
+    //! the views are created with the offscreen platform when no other is requested
+    if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+
+    //! the corona creates and changes its layouts under the home directory, the
+    //! user configuration must not be touched, the installed packages are still found
+    QTemporaryDir home;
+
+    if (!home.isValid()) {
+        qWarning() << "Benchmarks home directory could not be created:" << home.path();
+        return 1;
+    }
+
+    if (!qEnvironmentVariableIsSet("XDG_DATA_HOME")) {
+        qputenv("XDG_DATA_HOME", QFile::encodeName(QDir::homePath() + QStringLiteral("/.local/share")));
+    }
+
+    qputenv("HOME", QFile::encodeName(home.path()));
+    qputenv("XDG_CONFIG_HOME", QFile::encodeName(home.path() + QStringLiteral("/.config")));
+
+    QQuickWindow::setDefaultAlphaBuffer(true);
+
+    QApplication app(argc, argv);
+    app.setApplicationName(QStringLiteral("lattedock"));
+    app.setQuitOnLastWindowClosed(false);
+
+    Latte::CoronaBenchmarks benchmarks;
+
+    return Latte::execBenchmarks(&benchmarks, app.arguments(), QStringLiteral("latte-corona-benchmarks.json"));
+}
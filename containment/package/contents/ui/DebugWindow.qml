@@ -33,6 +33,13 @@ Window{
 
     property string space:" :   "
 
+    Binding{
+        target: latteView && latteView.frameStatistics ? latteView.frameStatistics : null
+        property: "enabled"
+        when: latteView && latteView.frameStatistics
+        value: true
+    }
+
     PlasmaExtras.ScrollArea {
         id: scrollArea
 
@@ -750,6 +757,22 @@ Window{
                 text: layoutsContainer.endLayout.sizeWithNoFillApplets+" px."
             }
 
+            Text{
+                text: "   -----------   "
+            }
+
+            Text{
+                text: " -----------   "
+            }
+
+            Text{
+                text: "Frame Statistics"+space
+            }
+
+            Text{
+                text: latteView && latteView.frameStatistics ? latteView.frameStatistics.summary : "___"
+            }
+
         }
 
     }
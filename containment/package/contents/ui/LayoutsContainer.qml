@@ -26,8 +26,6 @@ import org.kde.plasma.plasmoid 2.0
 import org.kde.plasma.core 2.0 as PlasmaCore
 import org.kde.latte 0.2 as Latte
 
-import "../code/HeuristicTools.js" as HeuristicTools
-
 Item{
     id: layoutsContainer
 
@@ -690,11 +688,25 @@ Item{
         }
     }
 
-    //! This timer is needed in order to reduce the calls to heavy cpu function
-    //! HeuristicTools.updateSizeForAppletsInFill()
+    //! This timer is needed in order to reduce the calls to the fill layout solver
     Timer{
         id: updateSizeForAppletsInFillTimer
         interval: 10
-        onTriggered: HeuristicTools.updateSizeForAppletsInFill();
+        onTriggered: {
+            if ((visibilityManager.normalState && !root.editMode)
+                    || (root.behaveAsPlasmaPanel && root.editMode)) {
+                fillLayoutSolver.updateSizes(root.panelAlignment === Latte.Types.Justify,
+                                             root.maxLength,
+                                             root.panelEdgeSpacing,
+                                             root.isVertical ? root.width : root.height);
+            }
+        }
+    }
+
+    Latte.FillLayoutSolver{
+        id: fillLayoutSolver
+        startLayout: _startLayout
+        mainLayout: _mainLayout
+        endLayout: _endLayout
     }
 }
@@ -74,47 +74,18 @@ Item {
             return taskIndex;
         } else {
             // console.log("ch 2...");
-            root.updateScale(index, zScale, zStep);
+            parabolicEngine.updateScale(index, zScale, zStep);
             return -1;
         }
     }
 
 
     function applyParabolicEffect(index, currentMousePosition, center) {
-        var rDistance = Math.abs(currentMousePosition  - center);
+        var reversed = (Qt.application.layoutDirection === Qt.RightToLeft && !root.isVertical);
+        var scales = parabolicEngine.neighbourScales(currentMousePosition, center, reversed);
 
-        //check if the mouse goes right or down according to the center
-        var positiveDirection =  ((currentMousePosition  - center) >= 0 );
-
-        if (Qt.application.layoutDirection === Qt.RightToLeft && !root.isVertical) {
-            positiveDirection = !positiveDirection;
-        }
-
-        //finding the zoom center e.g. for zoom:1.7, calculates 0.35
-        var zoomCenter = (root.zoomFactor - 1) / 2
-
-        //computes the in the scale e.g. 0...0.35 according to the mouse distance
-        //0.35 on the edge and 0 in the center
-        var firstComputation = (rDistance / center) * zoomCenter;
-
-        //calculates the scaling for the neighbour tasks
-        var bigNeighbourZoom = Math.min(1 + zoomCenter + firstComputation, root.zoomFactor);
-        var smallNeighbourZoom = Math.max(1 + zoomCenter - firstComputation, 1);
-
-        //bigNeighbourZoom = Number(bigNeighbourZoom.toFixed(4));
-        //smallNeighbourZoom = Number(smallNeighbourZoom.toFixed(4));
-
-        var leftScale;
-        var rightScale;
-
-        if(positiveDirection === true){
-            rightScale = bigNeighbourZoom;
-            leftScale = smallNeighbourZoom;
-        }
-        else {
-            rightScale = smallNeighbourZoom;
-            leftScale = bigNeighbourZoom;
-        }
+        var leftScale = scales.leftScale;
+        var rightScale = scales.rightScale;
 
         var gAppletIndex = -1;
         var lAppletIndex = -1;
@@ -192,51 +163,11 @@ Item {
     }
 
     function clearAppletsGreaterThan(index) {
-        var startLastIndex = layoutsContainer.startLayout.beginIndex+layoutsContainer.startLayout.count-1;
-        if (index<startLastIndex) {
-            for (var i=index+1; i<=startLastIndex; ++i)
-                root.updateScale(i, 1, 0);
-        }
-
-        var mainLastIndex = layoutsContainer.mainLayout.beginIndex+layoutsContainer.mainLayout.count-1;
-        if (index<mainLastIndex){
-            var mainClearStart = index>layoutsContainer.mainLayout.beginIndex ? index+1 : layoutsContainer.mainLayout.beginIndex;
-            for (var j=mainClearStart; j<=mainLastIndex; ++j)
-                root.updateScale(j, 1, 0);
-        }
-
-        var endLastIndex = layoutsContainer.endLayout.beginIndex+layoutsContainer.endLayout.count-1;
-        if (index<endLastIndex){
-            var endClearStart = index>layoutsContainer.endLayout.beginIndex ? index+1 : layoutsContainer.endLayout.beginIndex;
-            for (var k=endClearStart; k<=endLastIndex; ++k)
-                root.updateScale(k, 1, 0);
-        }
+        parabolicEngine.clearScalesGreaterThan(index);
     }
 
     function clearAppletsLowerThan(index) {
-        var startBeginIndex = layoutsContainer.startLayout.beginIndex;
-        var startLastIndex = layoutsContainer.startLayout.beginIndex+layoutsContainer.startLayout.count-1;
-        if (index>startBeginIndex) {
-            var startClearStart = index<=startLastIndex ? index-1 : startLastIndex;
-            for (var i=startClearStart; i>=startBeginIndex; --i)
-                root.updateScale(i, 1, 0);
-        }
-
-        var mainBeginIndex = layoutsContainer.mainLayout.beginIndex;
-        var mainLastIndex = layoutsContainer.mainLayout.beginIndex+layoutsContainer.mainLayout.count-1;
-        if (index>mainBeginIndex) {
-            var mainClearStart = index<=mainLastIndex ? index-1 : mainLastIndex;
-            for (var j=mainClearStart; j>=mainBeginIndex; --j)
-                root.updateScale(j, 1, 0);
-        }
-
-        var endBeginIndex = layoutsContainer.endLayout.beginIndex;
-        var endLastIndex = layoutsContainer.endLayout.beginIndex+layoutsContainer.endLayout.count-1;
-        if (index>endBeginIndex) {
-            var endClearStart = index<=endLastIndex ? index-1 : endLastIndex;
-            for (var k=endClearStart; k>=endBeginIndex; --k)
-                root.updateScale(k, 1, 0);
-        }
+        parabolicEngine.clearScalesLowerThan(index);
     }
 
     // update the registered separators
@@ -137,6 +137,20 @@ Item{
         value: root.panelAlignment
     }
 
+    Binding{
+        target: latteView && latteView.frameStatistics ? latteView.frameStatistics : null
+        property: "zooming"
+        when: latteView && latteView.frameStatistics
+        value: root.zoomFactor > 1 && root.isHovered
+    }
+
+    Binding{
+        target: latteView && latteView.frameStatistics ? latteView.frameStatistics : null
+        property: "sliding"
+        when: latteView && latteView.frameStatistics
+        value: inSlidingIn || inSlidingOut
+    }
+
     Binding{
         target: latteView && latteView.effects ? latteView.effects : null
         property: "backgroundOpacity"
@@ -46,7 +46,6 @@ Item {
     property bool canBeHovered: true
     property bool canShowAppletNumberBadge: !isSeparator && !isHidden && !isLattePlasmoid
                                             && !isSpacer && !isInternalViewSplitter
-    property bool inFillCalculations: false //temp record, is used in calculations for fillWidth,fillHeight applets
     property bool needsFillSpace: { //fill flag, it is used in calculations for fillWidth,fillHeight applets
         if (!applet || !applet.Layout ||  (applet && applet.pluginName === "org.kde.plasma.panelspacer"))
             return false;
@@ -100,6 +99,14 @@ Item {
 
     property int previousIndex: -1
     property int sizeForFill: -1 //it is used in calculations for fillWidth,fillHeight applets
+
+    //! the applet constraints along the panel, they are used in calculations for fillWidth,fillHeight applets
+    readonly property real fillMinimumSize: applet && applet.Layout ?
+                                                (root.isVertical ? applet.Layout.minimumHeight : applet.Layout.minimumWidth) : -1
+    readonly property real fillPreferredSize: applet && applet.Layout ?
+                                                  (root.isVertical ? applet.Layout.preferredHeight : applet.Layout.preferredWidth) : -1
+    readonly property real fillMaximumSize: applet && applet.Layout ?
+                                                (root.isVertical ? applet.Layout.maximumHeight : applet.Layout.maximumWidth) : -1
     property int spacersMaxSize: Math.max(0,Math.ceil(0.5*root.iconSize) - root.iconMargin)
     property int status: applet ? applet.status : -1
 
@@ -726,11 +726,13 @@ Item{
         }
     }
 
+    onIndexChanged: parabolicEngine.registerItem(index, wrapper, "zoomScale");
+
     Component.onCompleted: {
-        root.updateScale.connect(signalUpdateScale);
+        parabolicEngine.registerItem(index, wrapper, "zoomScale");
     }
 
     Component.onDestruction: {
-        root.updateScale.disconnect(signalUpdateScale);
+        parabolicEngine.unregisterItem(wrapper);
     }
 }// Main task area // id:wrapper
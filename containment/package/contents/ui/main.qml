@@ -380,6 +380,7 @@ DragDrop.DropArea {
     property QtObject themeExtended: null
     property QtObject universalSettings: null
     property QtObject universalLayoutManager: null
+    property QtObject appletEndpoints: universalLayoutManager ? universalLayoutManager.appletEndpoints : null
     property QtObject managedLayout: latteView && latteView.managedLayout ? latteView.managedLayout : null
 
     // TO BE DELETED, if not needed: property int counter:0;
@@ -388,6 +389,8 @@ DragDrop.DropArea {
     //shadows for applets, it should be removed as the appleitems don't need it any more
     property bool enableShadows: plasmoid.configuration.shadows || (root.forceTransparentPanel && plasmoid.configuration.shadows>0)
     property bool dockIsHidden: latteView ? latteView.visibility.isHidden : true
+    //! the view is hidden for a while, its animations must not request new frames
+    property bool dockResourcesReleased: latteView ? latteView.visibility.resourcesReleased : false
     property bool groupTasksByDefault: plasmoid.configuration.groupTasksByDefault
     property bool dotsOnActive: plasmoid.configuration.dotsOnActive
     property bool reverseLinesPosition: !latteApplet && plasmoid.configuration.panelSize===100 ?
@@ -540,6 +543,9 @@ DragDrop.DropArea {
     //////////////START OF CONNECTIONS
     onContainsOnlyPlasmaTasksChanged: updateAutomaticIconSize();
 
+    //! scale updates reach only the applet that they are meant for
+    onUpdateScale: parabolicEngine.updateScale(delegateIndex, newScale, step);
+
     onEditModeChanged: {
         if (editMode) {
             visibilityManager.updateMaskArea();
@@ -586,6 +592,13 @@ DragDrop.DropArea {
         }
     }
 
+    //! register the functions that are called from globalshortcuts c++ side
+    onAppletEndpointsChanged: {
+        if (appletEndpoints) {
+            appletEndpoints.registerContainment(root);
+        }
+    }
+
     onDockContainsMouseChanged: {
         if (!dockContainsMouse) {
             initializeHoveredIndexes();
@@ -765,6 +778,10 @@ DragDrop.DropArea {
     Component.onDestruction: {
         console.debug("Destroying Latte Dock Containment ui...");
 
+        if (appletEndpoints) {
+            appletEndpoints.unregisterEndpoint(root);
+        }
+
         if (latteView) {
             latteView.onAddInternalViewSplitter.disconnect(addInternalViewSplitters);
             latteView.onRemoveInternalViewSplitter.disconnect(removeInternalViewSplitters);
@@ -1677,6 +1694,11 @@ DragDrop.DropArea {
         id: _parabolicManager
     }
 
+    Latte.ParabolicEngine{
+        id: parabolicEngine
+        zoomFactor: root.zoomFactor
+    }
+
     ///////////////END components
 
     PlasmaCore.ColorScope{
@@ -109,14 +109,29 @@ QList<QAction *> Menu::contextualActions()
     actions << m_addWidgetsAction;
     actions << m_configureAction;
 
-    m_data.clear();
-    QDBusInterface iface("org.kde.lattedock", "/Latte", "", QDBusConnection::sessionBus());
+    if (QObject *corona = latteCorona()) {
+        int containmentId = (int)containment()->id();
 
-    if (iface.isValid()) {
-        iface.call("setContextMenuView", (int)containment()->id());
-        QDBusReply<QStringList> replyData = iface.call("contextMenuData");
+        if (m_dataDirty || m_dataContainmentId != containmentId) {
+            m_data.clear();
+            QMetaObject::invokeMethod(corona, "viewContextMenuData", Qt::DirectConnection,
+                                      Q_RETURN_ARG(QStringList, m_data),
+                                      Q_ARG(int, containmentId));
 
-        m_data = replyData.value();
+            m_dataContainmentId = containmentId;
+            m_dataDirty = false;
+        }
+    } else {
+        m_data.clear();
+
+        QDBusInterface iface("org.kde.lattedock", "/Latte", "", QDBusConnection::sessionBus());
+
+        if (iface.isValid()) {
+            iface.call("setContextMenuView", (int)containment()->id());
+            QDBusReply<QStringList> replyData = iface.call("contextMenuData");
+
+            m_data = replyData.value();
+        }
     }
 
     if (m_data.size() > LAYOUTSPOS + 1) {
@@ -135,6 +150,32 @@ QList<QAction *> Menu::contextualActions()
     return actions;
 }
 
+QObject *Menu::latteCorona()
+{
+    QObject *corona = containment() ? containment()->corona() : nullptr;
+
+    if (!corona) {
+        return nullptr;
+    }
+
+    if (m_checkedCorona != corona) {
+        m_checkedCorona = corona;
+        m_isLatteCorona = (corona->metaObject()->indexOfMethod("viewContextMenuData(int)") >= 0);
+        m_dataDirty = true;
+
+        if (m_isLatteCorona) {
+            connect(corona, SIGNAL(contextMenuDataChanged()), this, SLOT(invalidateData()), Qt::UniqueConnection);
+        }
+    }
+
+    return m_isLatteCorona ? corona : nullptr;
+}
+
+void Menu::invalidateData()
+{
+    m_dataDirty = true;
+}
+
 QAction *Menu::action(const QString &name)
 {
     if (name == "add widgets") {
@@ -201,6 +242,12 @@ void Menu::switchToLayout(QAction *action)
 
     if (layout == " _show_latte_settings_dialog_") {
         QTimer::singleShot(400, [this]() {
+            if (QObject *corona = latteCorona()) {
+                QMetaObject::invokeMethod(corona, "showSettingsWindow", Qt::DirectConnection,
+                                          Q_ARG(int, (int)Latte::Types::LayoutPage));
+                return;
+            }
+
             QDBusInterface iface("org.kde.lattedock", "/Latte", "", QDBusConnection::sessionBus());
 
             if (iface.isValid()) {
@@ -209,6 +256,12 @@ void Menu::switchToLayout(QAction *action)
         });
     } else {
         QTimer::singleShot(400, [this, layout]() {
+            if (QObject *corona = latteCorona()) {
+                QMetaObject::invokeMethod(corona, "switchToLayout", Qt::DirectConnection,
+                                          Q_ARG(QString, layout));
+                return;
+            }
+
             QDBusInterface iface("org.kde.lattedock", "/Latte", "", QDBusConnection::sessionBus());
 
             if (iface.isValid()) {
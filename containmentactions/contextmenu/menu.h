@@ -22,6 +22,7 @@
 
 // Qt
 #include <QObject>
+#include <QPointer>
 
 // Plasma
 #include <Plasma/ContainmentActions>
@@ -45,11 +46,25 @@ private Q_SLOTS:
     void populateLayouts();
     void requestConfiguration();
     void switchToLayout(QAction *action);
+    void invalidateData();
 
+private:
+    //! it returns the Latte corona when the containment action is loaded
+    //! inside Latte, in that case dbus is not needed
+    QObject *latteCorona();
 
 private:
+    bool m_isLatteCorona{false};
+    //! the in-process data are requested again only after Latte
+    //! reported that they changed
+    bool m_dataDirty{true};
+
+    int m_dataContainmentId{-1};
+
     QStringList m_data;
 
+    QPointer<QObject> m_checkedCorona;
+
     QList<QAction *>m_actions;
 
     QAction *m_separator1{nullptr};
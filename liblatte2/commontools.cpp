@@ -21,6 +21,8 @@
 #include "commontools.h"
 
 // Qt
+#include <QCoreApplication>
+#include <QVariant>
 #include <QtMath>
 
 namespace Latte {
@@ -71,4 +73,23 @@ float colorLumina(float r, float g, float b)
     return luminosity;
 }
 
+void *sharedInstance(const char *property, void *created)
+{
+    QCoreApplication *app = QCoreApplication::instance();
+
+    if (!app) {
+        return created;
+    }
+
+    QVariant published = app->property(property);
+
+    if (published.isValid()) {
+        return reinterpret_cast<void *>(published.value<quintptr>());
+    }
+
+    app->setProperty(property, QVariant::fromValue<quintptr>(reinterpret_cast<quintptr>(created)));
+
+    return created;
+}
+
 }
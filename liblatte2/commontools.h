@@ -31,4 +31,10 @@ float colorLumina(QColor color);
 float colorLumina(QRgb rgb);
 float colorLumina(float r, float g, float b);
 
+//! the application and the qml plugin contain their own copy of the liblatte2
+//! code, the first one that asks for a shared instance publishes it in the
+//! application instance under the given property and the other one finds it
+//! there. The instance that is returned is either the published or the created one
+void *sharedInstance(const char *property, void *created);
+
 }
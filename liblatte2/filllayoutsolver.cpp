@@ -0,0 +1,383 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "filllayoutsolver.h"
+
+// Qt
+#include <QtMath>
+
+namespace Latte {
+
+FillLayoutSolver::FillLayoutSolver(QObject *parent)
+    : QObject(parent)
+{
+    connect(this, &FillLayoutSolver::startLayoutChanged, this, &FillLayoutSolver::invalidate);
+    connect(this, &FillLayoutSolver::mainLayoutChanged, this, &FillLayoutSolver::invalidate);
+    connect(this, &FillLayoutSolver::endLayoutChanged, this, &FillLayoutSolver::invalidate);
+}
+
+FillLayoutSolver::~FillLayoutSolver()
+{
+}
+
+QQuickItem *FillLayoutSolver::startLayout() const
+{
+    return m_startLayout;
+}
+
+void FillLayoutSolver::setStartLayout(QQuickItem *layout)
+{
+    if (m_startLayout == layout) {
+        return;
+    }
+
+    m_startLayout = layout;
+    emit startLayoutChanged();
+}
+
+QQuickItem *FillLayoutSolver::mainLayout() const
+{
+    return m_mainLayout;
+}
+
+void FillLayoutSolver::setMainLayout(QQuickItem *layout)
+{
+    if (m_mainLayout == layout) {
+        return;
+    }
+
+    m_mainLayout = layout;
+    emit mainLayoutChanged();
+}
+
+QQuickItem *FillLayoutSolver::endLayout() const
+{
+    return m_endLayout;
+}
+
+void FillLayoutSolver::setEndLayout(QQuickItem *layout)
+{
+    if (m_endLayout == layout) {
+        return;
+    }
+
+    m_endLayout = layout;
+    emit endLayoutChanged();
+}
+
+void FillLayoutSolver::invalidate()
+{
+    m_valid = false;
+}
+
+bool FillLayoutSolver::Inputs::operator==(const Inputs &other) const
+{
+    return justify == other.justify
+           && qFuzzyCompare(1 + maxLength, 1 + other.maxLength)
+           && qFuzzyCompare(1 + edgeSpacing, 1 + other.edgeSpacing)
+           && qFuzzyCompare(1 + thickness, 1 + other.thickness);
+}
+
+qreal FillLayoutSolver::layoutBound(qreal min, qreal pref, qreal max) const
+{
+    if (max == -1) {
+        max = pref == -1 ? min : pref;
+    }
+
+    if (pref == -1) {
+        pref = max == -1 ? min : pref;
+    }
+
+    return qMin(qMax(min, pref), max);
+}
+
+FillLayoutSolver::LayoutData FillLayoutSolver::layoutData(QQuickItem *layout) const
+{
+    LayoutData data;
+
+    if (!layout) {
+        return data;
+    }
+
+    data.shownApplets = layout->property("shownApplets").toInt();
+    data.sizeWithNoFillApplets = layout->property("sizeWithNoFillApplets").toReal();
+
+    for (QQuickItem *item : layout->childItems()) {
+        if (!item || !item->property("needsFillSpace").toBool()) {
+            continue;
+        }
+
+        FillApplet applet;
+        applet.item = item;
+        applet.hidden = item->property("isHidden").toBool();
+        applet.minimumSize = item->property("fillMinimumSize").toReal();
+        applet.preferredSize = item->property("fillPreferredSize").toReal();
+        applet.maximumSize = item->property("fillMaximumSize").toReal();
+        applet.size = item->property("sizeForFill").toInt();
+
+        data.applets.append(applet);
+    }
+
+    data.fillApplets = data.applets.count();
+
+    return data;
+}
+
+bool FillLayoutSolver::sameApplets(const LayoutData &layout, const LayoutData &previous) const
+{
+    if (layout.fillApplets != previous.fillApplets
+            || layout.shownApplets != previous.shownApplets
+            || !qFuzzyCompare(1 + layout.sizeWithNoFillApplets, 1 + previous.sizeWithNoFillApplets)) {
+        return false;
+    }
+
+    for (int i = 0; i < layout.applets.count(); ++i) {
+        const FillApplet &applet = layout.applets[i];
+        const FillApplet &previousApplet = previous.applets[i];
+
+        //! the sizes that were applied must still be there
+        if (applet.item != previousApplet.item
+                || applet.hidden != previousApplet.hidden
+                || applet.size != previousApplet.size
+                || applet.minimumSize != previousApplet.minimumSize
+                || applet.preferredSize != previousApplet.preferredSize
+                || applet.maximumSize != previousApplet.maximumSize) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void FillLayoutSolver::computeStep1(LayoutData &layout, qreal &availableSpace, qreal &sizePerApplet, int &noOfApplets, qreal thickness) const
+{
+    for (auto &applet : layout.applets) {
+        qreal minSize = applet.minimumSize >= 0 && !qIsInf(applet.minimumSize) ? applet.minimumSize : -1;
+        qreal prefSize = minSize >= 0 && !qIsInf(applet.preferredSize) ? applet.preferredSize : -1;
+        qreal maxSize = applet.maximumSize >= 0 && !qIsInf(applet.maximumSize) ? applet.maximumSize : -1;
+
+        //! when the applet does not provide any valid metrics the space
+        //! is decided after the applets with valid metrics have gained theirs
+        bool systemDecide = (minSize < 0) && (prefSize < 0) && (maxSize < 0);
+
+        if (systemDecide) {
+            continue;
+        }
+
+        qreal appliedSize = -1;
+
+        if (noOfApplets > 1) {
+            appliedSize = layoutBound(minSize, prefSize, maxSize);
+        } else if (noOfApplets == 1) {
+            //! the last applet must not exceed the available space
+            appliedSize = layoutBound(minSize, prefSize, qMin(maxSize, sizePerApplet));
+        }
+
+        //! when the applied size is bigger than the proposed one, the applet
+        //! gains its space fairly during step2
+        if (appliedSize >= 0 && appliedSize <= sizePerApplet) {
+            qreal properSize = qMin(appliedSize, availableSpace);
+
+            applet.size = applet.hidden ? 0 : static_cast<int>(qMax(thickness, properSize));
+            applet.inFillCalculations = false;
+
+            availableSpace = qMax(qreal(0), availableSpace - applet.size);
+            noOfApplets = noOfApplets - 1;
+            sizePerApplet = noOfApplets > 1 ? qFloor(availableSpace / noOfApplets) : availableSpace;
+        }
+    }
+}
+
+void FillLayoutSolver::computeStep2(LayoutData &layout, qreal sizePerApplet, int noOfApplets) const
+{
+    if (sizePerApplet <= 0) {
+        return;
+    }
+
+    if (noOfApplets != 0) {
+        for (auto &applet : layout.applets) {
+            if (applet.inFillCalculations) {
+                applet.size = static_cast<int>(sizePerApplet);
+                applet.inFillCalculations = false;
+            }
+        }
+
+        return;
+    }
+
+    //! all applets have gained their size and there is still free space,
+    //! the most demanding applet is the one that provided valid metrics, has
+    //! an infinite maximum size and gained the biggest space from step1
+    FillApplet *mostDemandingApplet{nullptr};
+    int mostDemandingAppletSize{0};
+
+    //! applets with no strong opinion
+    QVector<FillApplet *> neutralApplets;
+
+    for (auto &applet : layout.applets) {
+        bool isNeutral = applet.minimumSize <= 0 && applet.preferredSize <= 0;
+
+        if (!isNeutral && qIsInf(applet.maximumSize) && applet.size > mostDemandingAppletSize) {
+            mostDemandingApplet = &applet;
+            mostDemandingAppletSize = applet.size;
+        } else if (isNeutral) {
+            neutralApplets << &applet;
+        }
+    }
+
+    if (mostDemandingApplet) {
+        mostDemandingApplet->size = static_cast<int>(mostDemandingApplet->size + sizePerApplet);
+    } else if (!neutralApplets.isEmpty()) {
+        //! the free space is splitted equally between the neutral applets
+        qreal adjustedAppletSize = sizePerApplet / neutralApplets.count();
+
+        for (auto applet : neutralApplets) {
+            applet->size = static_cast<int>(applet->size + adjustedAppletSize);
+        }
+    }
+}
+
+void FillLayoutSolver::applySizes(const LayoutData &layout) const
+{
+    for (const auto &applet : layout.applets) {
+        if (applet.item && applet.item->property("sizeForFill").toInt() != applet.size) {
+            applet.item->setProperty("sizeForFill", applet.size);
+        }
+    }
+}
+
+void FillLayoutSolver::updateSizes(bool justify, qreal maxLength, qreal edgeSpacing, qreal thickness)
+{
+    Inputs inputs;
+    inputs.justify = justify;
+    inputs.maxLength = maxLength;
+    inputs.edgeSpacing = edgeSpacing;
+    inputs.thickness = thickness;
+
+    LayoutData start = layoutData(m_startLayout);
+    LayoutData main = layoutData(m_mainLayout);
+    LayoutData end = layoutData(m_endLayout);
+
+    int noA = start.fillApplets + main.fillApplets + end.fillApplets;
+
+    if (noA == 0) {
+        return;
+    }
+
+    if (m_valid && inputs == m_lastInputs
+            && sameApplets(start, m_lastStart) && sameApplets(main, m_lastMain) && sameApplets(end, m_lastEnd)) {
+        return;
+    }
+
+    if (main.shownApplets == 0 || !justify) {
+        qreal availableSpace = qMax(qreal(0), maxLength - start.sizeWithNoFillApplets - main.sizeWithNoFillApplets
+                                    - end.sizeWithNoFillApplets - edgeSpacing);
+        qreal sizePerApplet = availableSpace / noA;
+
+        //! step1 for the applets that want to fill space but
+        //! their maximum metrics are lower than the sizePerApplet
+        computeStep1(main, availableSpace, sizePerApplet, noA, thickness);
+
+        if (justify) {
+            computeStep1(start, availableSpace, sizePerApplet, noA, thickness);
+            computeStep1(end, availableSpace, sizePerApplet, noA, thickness);
+        }
+
+        //! when all applets gained a valid space during step1 but some
+        //! space remained free, that space is assigned to the most demanding
+        //! applet of the first layout that has fill applets
+        bool remainedSpace = (noA == 0 && sizePerApplet > 0);
+
+        int startNo{-1};
+        int mainNo{-1};
+        int endNo{-1};
+
+        if (remainedSpace) {
+            if (start.fillApplets > 0) {
+                startNo = 0;
+            } else if (end.fillApplets > 0) {
+                endNo = 0;
+            } else if (main.fillApplets > 0) {
+                mainNo = 0;
+            }
+        }
+
+        computeStep2(start, sizePerApplet, startNo);
+        computeStep2(main, sizePerApplet, mainNo);
+        computeStep2(end, sizePerApplet, endNo);
+    } else {
+        //! the two free spaces around the centered layout
+        qreal halfMainLayout = main.sizeWithNoFillApplets / 2;
+        qreal availableSpaceStart = qMax(qreal(0), maxLength / 2 - start.sizeWithNoFillApplets - halfMainLayout - edgeSpacing / 2);
+        qreal availableSpaceEnd = qMax(qreal(0), maxLength / 2 - end.sizeWithNoFillApplets - halfMainLayout - edgeSpacing / 2);
+        qreal availableSpace = availableSpaceStart + availableSpaceEnd - main.sizeWithNoFillApplets;
+
+        qreal sizePerAppletMain = main.fillApplets > 0 ? availableSpace / noA : 0;
+
+        int noStart = start.fillApplets;
+        int noMain = main.fillApplets;
+        int noEnd = end.fillApplets;
+
+        if (main.fillApplets > 0) {
+            qreal availableSpaceMain = availableSpace;
+            computeStep1(main, availableSpaceMain, sizePerAppletMain, noMain, thickness);
+
+            qreal dif = (availableSpace - availableSpaceMain) / 2;
+            availableSpaceStart = availableSpaceStart - dif;
+            availableSpaceEnd = availableSpaceEnd - dif;
+        }
+
+        qreal sizePerAppletStart = start.fillApplets > 0 ? availableSpaceStart / noStart : 0;
+        qreal sizePerAppletEnd = end.fillApplets > 0 ? availableSpaceEnd / noEnd : 0;
+
+        if (start.fillApplets > 0) {
+            computeStep1(start, availableSpaceStart, sizePerAppletStart, noStart, thickness);
+        }
+
+        if (end.fillApplets > 0) {
+            computeStep1(end, availableSpaceEnd, sizePerAppletEnd, noEnd, thickness);
+        }
+
+        if (main.fillApplets > 0) {
+            computeStep2(main, sizePerAppletMain, noMain);
+        }
+
+        if (start.fillApplets > 0) {
+            computeStep2(start, sizePerAppletStart, noStart);
+        }
+
+        if (end.fillApplets > 0) {
+            computeStep2(end, sizePerAppletEnd, noEnd);
+        }
+    }
+
+    //! only the applets whose size changed are touched, this way
+    //! the layouts that are not affected are not relayouted
+    applySizes(start);
+    applySizes(main);
+    applySizes(end);
+
+    m_valid = true;
+    m_lastInputs = inputs;
+    m_lastStart = start;
+    m_lastMain = main;
+    m_lastEnd = end;
+}
+
+}
@@ -0,0 +1,136 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef FILLLAYOUTSOLVER_H
+#define FILLLAYOUTSOLVER_H
+
+// Qt
+#include <QObject>
+#include <QPointer>
+#include <QQuickItem>
+#include <QVector>
+
+namespace Latte {
+
+//! It computes the sizes of the applets that are requesting fillWidth or
+//! fillHeight in the start/main/end layouts of a containment.
+//! The applets must provide their cached constraints along the panel through
+//! the fillMinimumSize, fillPreferredSize and fillMaximumSize properties and
+//! they receive their computed size in their sizeForFill property.
+//! When nothing that affects the computations has changed since the last
+//! solution the applets are not touched at all.
+class FillLayoutSolver : public QObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY(QQuickItem *startLayout READ startLayout WRITE setStartLayout NOTIFY startLayoutChanged)
+    Q_PROPERTY(QQuickItem *mainLayout READ mainLayout WRITE setMainLayout NOTIFY mainLayoutChanged)
+    Q_PROPERTY(QQuickItem *endLayout READ endLayout WRITE setEndLayout NOTIFY endLayoutChanged)
+
+public:
+    FillLayoutSolver(QObject *parent = nullptr);
+    ~FillLayoutSolver() override;
+
+    QQuickItem *startLayout() const;
+    void setStartLayout(QQuickItem *layout);
+
+    QQuickItem *mainLayout() const;
+    void setMainLayout(QQuickItem *layout);
+
+    QQuickItem *endLayout() const;
+    void setEndLayout(QQuickItem *layout);
+
+public slots:
+    //! justify: the containment uses the Justify alignment
+    //! maxLength: the maximum length of the view
+    //! edgeSpacing: the space used at the view edges
+    //! thickness: the minimum size that a shown fill applet can have
+    Q_INVOKABLE void updateSizes(bool justify, qreal maxLength, qreal edgeSpacing, qreal thickness);
+
+    //! forget the last solution, the next update is always applied
+    Q_INVOKABLE void invalidate();
+
+signals:
+    void startLayoutChanged();
+    void mainLayoutChanged();
+    void endLayoutChanged();
+
+private:
+    struct FillApplet {
+        QQuickItem *item{nullptr};
+
+        bool hidden{false};
+        //! it has not gained a size yet during the current solution
+        bool inFillCalculations{true};
+
+        qreal minimumSize{-1};
+        qreal preferredSize{-1};
+        qreal maximumSize{-1};
+
+        int size{-1};
+    };
+
+    struct LayoutData {
+        QVector<FillApplet> applets;
+
+        int fillApplets{0};
+        int shownApplets{0};
+        qreal sizeWithNoFillApplets{0};
+    };
+
+    struct Inputs {
+        bool justify{false};
+        qreal maxLength{0};
+        qreal edgeSpacing{0};
+        qreal thickness{0};
+
+        bool operator==(const Inputs &other) const;
+    };
+
+    //! qBound style function that ignores the -1 values
+    qreal layoutBound(qreal min, qreal pref, qreal max) const;
+
+    //! step1: the applets that provide valid metrics gain their space
+    void computeStep1(LayoutData &layout, qreal &availableSpace, qreal &sizePerApplet, int &noOfApplets, qreal thickness) const;
+    //! step2: the remaining applets gain the proposed size or, when all applets
+    //! have gained a size, the remaining space is given to the most demanding one
+    void computeStep2(LayoutData &layout, qreal sizePerApplet, int noOfApplets) const;
+
+    bool sameApplets(const LayoutData &layout, const LayoutData &previous) const;
+
+    void applySizes(const LayoutData &layout) const;
+
+    LayoutData layoutData(QQuickItem *layout) const;
+
+private:
+    QPointer<QQuickItem> m_startLayout;
+    QPointer<QQuickItem> m_mainLayout;
+    QPointer<QQuickItem> m_endLayout;
+
+    bool m_valid{false};
+
+    Inputs m_lastInputs;
+    LayoutData m_lastStart;
+    LayoutData m_lastMain;
+    LayoutData m_lastEnd;
+};
+
+}
+
+#endif
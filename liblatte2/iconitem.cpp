@@ -24,6 +24,8 @@
 
 // local
 #include "../liblatte2/extras.h"
+#include "../liblatte2/statistics.h"
+#include "../liblatte2/tracer.h"
 
 // Qt
 #include <QDebug>
@@ -437,10 +439,14 @@ void IconItem::updateColors()
 
 void IconItem::loadPixmap()
 {
+    LATTE_TRACE_SCOPE("plugin", "IconItem::loadPixmap");
+
     if (!isComponentComplete()) {
         return;
     }
 
+    LATTE_COUNT(IconLoads);
+
     const auto size = qMin(width(), height());
     //final pixmap to paint
     QPixmap result;
@@ -512,8 +518,11 @@ void IconItem::loadPixmap()
     m_iconPixmap = result;
 
     if (m_providesColors && m_lastValidSourceName != m_lastColorsSourceName) {
+        LATTE_COUNT(IconColorsMisses);
         m_lastColorsSourceName = m_lastValidSourceName;
         updateColors();
+    } else if (m_providesColors) {
+        LATTE_COUNT(IconColorsHits);
     }
 
     m_textureChanged = true;
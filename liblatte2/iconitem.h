@@ -37,6 +37,8 @@
 
 // this file is based on PlasmaCore::IconItem class, thanks to KDE
 namespace Latte {
+class Benchmarks;
+
 class IconItem : public QQuickItem
 {
     Q_OBJECT
@@ -196,6 +198,8 @@ private:
     QVariant m_source;
 
     QSizeF m_implicitSize;
+
+    friend class Latte::Benchmarks;
 };
 
 }
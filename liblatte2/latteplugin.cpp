@@ -22,8 +22,11 @@
 
 // local
 #include "backgroundtracker.h"
+#include "filllayoutsolver.h"
 #include "iconitem.h"
+#include "parabolicengine.h"
 #include "quickwindowsystem.h"
+#include "sharedtasksmodel.h"
 #include "types.h"
 
 // Qt
@@ -34,6 +37,9 @@ void LattePlugin::registerTypes(const char *uri)
     Q_ASSERT(uri == QLatin1String("org.kde.latte"));
     qmlRegisterUncreatableType<Latte::Types>(uri, 0, 2, "Types", "Latte Types uncreatable");
     qmlRegisterType<Latte::BackgroundTracker>(uri, 0, 2, "BackgroundTracker");
+    qmlRegisterType<Latte::FillLayoutSolver>(uri, 0, 2, "FillLayoutSolver");
     qmlRegisterType<Latte::IconItem>(uri, 0, 2, "IconItem");
+    qmlRegisterType<Latte::ParabolicEngine>(uri, 0, 2, "ParabolicEngine");
+    qmlRegisterType<Latte::SharedTasksModel>(uri, 0, 2, "SharedTasksModel");
     qmlRegisterSingletonType<Latte::QuickWindowSystem>(uri, 0, 2, "WindowSystem", &Latte::windowsystem_qobject_singletontype_provider);
 }
@@ -0,0 +1,254 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "launchersstore.h"
+
+// Qt
+#include <QUrl>
+
+namespace Latte {
+
+const char NULLUUID[] = "00000000-0000-0000-0000-000000000000";
+const int PERSISTINTERVAL = 1000;
+
+LaunchersStore::LaunchersStore(QObject *parent)
+    : QObject(parent)
+{
+    m_persistTimer.setSingleShot(true);
+    m_persistTimer.setInterval(PERSISTINTERVAL);
+    connect(&m_persistTimer, &QTimer::timeout, this, &LaunchersStore::persistRequested);
+}
+
+LaunchersStore::~LaunchersStore()
+{
+    m_persistTimer.stop();
+}
+
+int LaunchersStore::count() const
+{
+    return m_entries.count();
+}
+
+QStringList LaunchersStore::launchers() const
+{
+    return m_launchers;
+}
+
+void LaunchersStore::setLaunchers(QStringList launchers)
+{
+    if (m_launchers == launchers) {
+        return;
+    }
+
+    m_launchers = launchers;
+    rebuild();
+
+    //! the timer is restarted on purpose, dragging a launcher around
+    //! produces many intermediate lists that do not need to be stored
+    m_persistTimer.start();
+
+    emit launchersChanged();
+}
+
+void LaunchersStore::loadLaunchers(QStringList launchers)
+{
+    m_persistTimer.stop();
+
+    if (m_launchers == launchers) {
+        return;
+    }
+
+    m_launchers = launchers;
+    rebuild();
+
+    emit launchersChanged();
+}
+
+bool LaunchersStore::persistPending() const
+{
+    return m_persistTimer.isActive();
+}
+
+void LaunchersStore::flush()
+{
+    if (!m_persistTimer.isActive()) {
+        return;
+    }
+
+    m_persistTimer.stop();
+    emit persistRequested();
+}
+
+QString LaunchersStore::key(const QString &url) const
+{
+    //! the tasks model provides the launchers urls without their icon data
+    if (!url.contains(QLatin1Char('?'))) {
+        return url;
+    }
+
+    return QUrl(url).adjusted(QUrl::RemoveQuery).toString();
+}
+
+int LaunchersStore::activityBit(const QString &activity) const
+{
+    return m_activityBits.value(activity, -1);
+}
+
+int LaunchersStore::addActivityBit(const QString &activity)
+{
+    int bit = activityBit(activity);
+
+    if (bit == -1) {
+        bit = m_activities.count();
+        m_activities << activity;
+        m_activityBits[activity] = bit;
+    }
+
+    return bit;
+}
+
+void LaunchersStore::rebuild()
+{
+    m_entries.clear();
+    m_indexes.clear();
+    m_activities.clear();
+    m_activityBits.clear();
+
+    m_entries.reserve(m_launchers.count());
+
+    for (const auto &serialized : m_launchers) {
+        Launcher launcher;
+        QStringList activities;
+
+        launcher.url = serialized;
+
+        //! same parsing as the one used from libtaskmanager
+        if (serialized.startsWith(QLatin1Char('['))) {
+            int blockEnd = serialized.indexOf(QLatin1String("]\n"));
+
+            if (blockEnd != -1) {
+                activities = serialized.mid(1, blockEnd - 1).split(QLatin1Char(','), QString::SkipEmptyParts);
+
+                if (!activities.isEmpty()) {
+                    launcher.url = serialized.mid(blockEnd + 2);
+                }
+            }
+        }
+
+        launcher.onAllActivities = activities.isEmpty() || activities.contains(QLatin1String(NULLUUID));
+
+        if (!launcher.onAllActivities) {
+            for (const auto &activity : activities) {
+                int bit = addActivityBit(activity);
+
+                if (launcher.activities.size() <= bit) {
+                    launcher.activities.resize(bit + 1);
+                }
+
+                launcher.activities.setBit(bit);
+            }
+        }
+
+        QString launcherKey = key(launcher.url);
+
+        if (!m_indexes.contains(launcherKey)) {
+            m_indexes[launcherKey] = m_entries.count();
+        }
+
+        m_entries.append(launcher);
+    }
+}
+
+bool LaunchersStore::contains(const QString &url) const
+{
+    return m_indexes.contains(key(url));
+}
+
+int LaunchersStore::indexOf(const QString &url) const
+{
+    return m_indexes.value(key(url), -1);
+}
+
+bool LaunchersStore::isOnAllActivities(const QString &url) const
+{
+    int index = indexOf(url);
+
+    return index >= 0 && m_entries[index].onAllActivities;
+}
+
+bool LaunchersStore::isOnActivity(const QString &url, const QString &activity) const
+{
+    int index = indexOf(url);
+
+    if (index < 0) {
+        return false;
+    }
+
+    const Launcher &launcher = m_entries[index];
+
+    if (launcher.onAllActivities) {
+        return true;
+    }
+
+    int bit = activityBit(activity);
+
+    return bit >= 0 && bit < launcher.activities.size() && launcher.activities.testBit(bit);
+}
+
+QStringList LaunchersStore::activities(const QString &url) const
+{
+    int index = indexOf(url);
+
+    if (index < 0) {
+        return QStringList();
+    }
+
+    const Launcher &launcher = m_entries[index];
+
+    if (launcher.onAllActivities) {
+        return QStringList(QLatin1String(NULLUUID));
+    }
+
+    QStringList activities;
+
+    for (int bit = 0; bit < launcher.activities.size(); ++bit) {
+        if (launcher.activities.testBit(bit)) {
+            activities << m_activities[bit];
+        }
+    }
+
+    return activities;
+}
+
+QStringList LaunchersStore::launchersForActivity(const QString &activity) const
+{
+    QStringList urls;
+    int bit = activityBit(activity);
+
+    for (const auto &launcher : m_entries) {
+        if (launcher.onAllActivities
+                || (bit >= 0 && bit < launcher.activities.size() && launcher.activities.testBit(bit))) {
+            urls << launcher.url;
+        }
+    }
+
+    return urls;
+}
+
+}
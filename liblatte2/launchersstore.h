@@ -0,0 +1,107 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef LAUNCHERSSTORE_H
+#define LAUNCHERSSTORE_H
+
+// Qt
+#include <QBitArray>
+#include <QHash>
+#include <QObject>
+#include <QStringList>
+#include <QTimer>
+#include <QVector>
+
+namespace Latte {
+
+//! It holds a launchers list in the libtaskmanager format, "[activity1,activity2]\nurl"
+//! or just "url" for launchers that are shown in all activities. The list is indexed
+//! by url and each launcher keeps its activities as a bitset, so the plasmoids that
+//! share it can check a launcher against an activity without parsing the list again.
+//! Changes are announced immediately but their persistence is requested only after
+//! a burst of changes has settled
+class LaunchersStore : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(int count READ count NOTIFY launchersChanged)
+    Q_PROPERTY(QStringList launchers READ launchers WRITE setLaunchers NOTIFY launchersChanged)
+
+public:
+    LaunchersStore(QObject *parent = nullptr);
+    ~LaunchersStore() override;
+
+    int count() const;
+
+    QStringList launchers() const;
+    void setLaunchers(QStringList launchers);
+
+    //! the list is loaded from the configuration, no persistence is requested
+    void loadLaunchers(QStringList launchers);
+
+    //! the list has changed and its persistence is still pending
+    bool persistPending() const;
+
+public slots:
+    Q_INVOKABLE bool contains(const QString &url) const;
+    Q_INVOKABLE int indexOf(const QString &url) const;
+
+    Q_INVOKABLE bool isOnAllActivities(const QString &url) const;
+    Q_INVOKABLE bool isOnActivity(const QString &url, const QString &activity) const;
+    Q_INVOKABLE QStringList activities(const QString &url) const;
+
+    //! the launchers urls, in order, that are shown in that activity
+    Q_INVOKABLE QStringList launchersForActivity(const QString &activity) const;
+
+    //! request the pending persistence immediately
+    void flush();
+
+signals:
+    void launchersChanged();
+    void persistRequested();
+
+private:
+    struct Launcher {
+        QString url;
+        bool onAllActivities{true};
+        QBitArray activities;
+    };
+
+    int activityBit(const QString &activity) const;
+    int addActivityBit(const QString &activity);
+
+    void rebuild();
+
+    QString key(const QString &url) const;
+
+private:
+    QStringList m_launchers;
+
+    QVector<Launcher> m_entries;
+    QHash<QString, int> m_indexes;
+
+    //! every activity gets its own bit the first time it is found in the list
+    QStringList m_activities;
+    QHash<QString, int> m_activityBits;
+
+    QTimer m_persistTimer;
+};
+
+}
+
+#endif
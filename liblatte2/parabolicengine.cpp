@@ -0,0 +1,197 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "parabolicengine.h"
+
+// Qt
+#include <QDebug>
+#include <QtMath>
+
+namespace Latte {
+
+ParabolicEngine::ParabolicEngine(QObject *parent)
+    : QObject(parent)
+{
+}
+
+ParabolicEngine::~ParabolicEngine()
+{
+    m_entries.clear();
+    m_indexes.clear();
+}
+
+qreal ParabolicEngine::zoomFactor() const
+{
+    return m_zoomFactor;
+}
+
+void ParabolicEngine::setZoomFactor(qreal factor)
+{
+    if (qFuzzyCompare(m_zoomFactor, factor)) {
+        return;
+    }
+
+    m_zoomFactor = factor;
+    emit zoomFactorChanged();
+}
+
+void ParabolicEngine::registerItem(int index, QQuickItem *item, const QString &scaleProperty)
+{
+    if (!item) {
+        return;
+    }
+
+    unregisterItem(item);
+
+    if (index < 0) {
+        return;
+    }
+
+    const QMetaObject *metaObject = item->metaObject();
+
+    //! "var" arguments are treated as QVariant in QMetaObject
+    int methodIndex = metaObject->indexOfMethod("signalUpdateScale(QVariant,QVariant,QVariant)");
+    int propertyIndex = metaObject->indexOfProperty(scaleProperty.toLatin1().constData());
+
+    if (methodIndex == -1 || propertyIndex == -1) {
+        qWarning() << "Parabolic engine can not handle item ::: " << item;
+        return;
+    }
+
+    Entry entry;
+    entry.item = item;
+    entry.updateScale = metaObject->method(methodIndex);
+    entry.scale = metaObject->property(propertyIndex);
+
+    //! during reordering two items can share the same index for a while,
+    //! the one that registered last is the one that is going to be updated
+    if (m_entries.contains(index) && m_entries[index].item) {
+        m_indexes.remove(m_entries[index].item);
+    }
+
+    m_entries[index] = entry;
+    m_indexes[item] = index;
+
+    connect(item, &QObject::destroyed, this, &ParabolicEngine::itemDestroyed, Qt::UniqueConnection);
+}
+
+void ParabolicEngine::unregisterItem(QQuickItem *item)
+{
+    itemDestroyed(item);
+}
+
+void ParabolicEngine::itemDestroyed(QObject *item)
+{
+    if (!m_indexes.contains(item)) {
+        return;
+    }
+
+    int index = m_indexes.take(item);
+
+    if (m_entries.contains(index) && (m_entries[index].item == item || m_entries[index].item.isNull())) {
+        m_entries.remove(index);
+    }
+}
+
+QVariantMap ParabolicEngine::neighbourScales(qreal currentMousePosition, qreal center, bool reversed) const
+{
+    qreal distance = qAbs(currentMousePosition - center);
+
+    //! check if the mouse goes right or down according to the center
+    bool positiveDirection = (currentMousePosition - center) >= 0;
+
+    if (reversed) {
+        positiveDirection = !positiveDirection;
+    }
+
+    //! finding the zoom center e.g. for zoom:1.7, calculates 0.35
+    qreal zoomCenter = (m_zoomFactor - 1) / 2;
+
+    //! computes the scale e.g. 0...0.35 according to the mouse distance,
+    //! 0.35 on the edge and 0 in the center
+    qreal firstComputation = center > 0 ? (distance / center) * zoomCenter : zoomCenter;
+
+    qreal bigNeighbourZoom = qMin(1 + zoomCenter + firstComputation, m_zoomFactor);
+    qreal smallNeighbourZoom = qMax(1 + zoomCenter - firstComputation, qreal(1));
+
+    QVariantMap scales;
+    scales["leftScale"] = positiveDirection ? smallNeighbourZoom : bigNeighbourZoom;
+    scales["rightScale"] = positiveDirection ? bigNeighbourZoom : smallNeighbourZoom;
+
+    return scales;
+}
+
+bool ParabolicEngine::isRestored(const Entry &entry) const
+{
+    //! the item scale can be changed also outside the engine, e.g. from
+    //! hovering it or from its animations
+    return qFuzzyCompare(entry.deliveredScale, qreal(1)) && qFuzzyCompare(entry.scale.read(entry.item).toReal(), qreal(1));
+}
+
+void ParabolicEngine::deliver(int index, Entry &entry, qreal scale, qreal step)
+{
+    entry.deliveredScale = scale >= 0 ? scale + step : entry.deliveredScale + step;
+    entry.updateScale.invoke(entry.item, Q_ARG(QVariant, index), Q_ARG(QVariant, scale), Q_ARG(QVariant, step));
+}
+
+void ParabolicEngine::updateScale(int index, qreal scale, qreal step)
+{
+    if (!m_entries.contains(index) || !m_entries[index].item) {
+        return;
+    }
+
+    deliver(index, m_entries[index], scale, step);
+}
+
+void ParabolicEngine::clearScalesGreaterThan(int index)
+{
+    QList<int> indexes;
+
+    for (auto it = m_entries.constBegin(); it != m_entries.constEnd(); ++it) {
+        if (it.key() > index && it.value().item && !isRestored(it.value())) {
+            indexes << it.key();
+        }
+    }
+
+    clearScales(indexes);
+}
+
+void ParabolicEngine::clearScalesLowerThan(int index)
+{
+    QList<int> indexes;
+
+    for (auto it = m_entries.constBegin(); it != m_entries.constEnd(); ++it) {
+        if (it.key() < index && it.value().item && !isRestored(it.value())) {
+            indexes << it.key();
+        }
+    }
+
+    clearScales(indexes);
+}
+
+void ParabolicEngine::clearScales(const QList<int> &indexes)
+{
+    //! the items are updated after the pass because their qml code
+    //! may register them again
+    for (int index : indexes) {
+        updateScale(index, 1, 0);
+    }
+}
+
+}
@@ -0,0 +1,99 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef PARABOLICENGINE_H
+#define PARABOLICENGINE_H
+
+// Qt
+#include <QHash>
+#include <QMetaMethod>
+#include <QMetaProperty>
+#include <QObject>
+#include <QPointer>
+#include <QQuickItem>
+#include <QVariantMap>
+
+namespace Latte {
+
+//! It computes the scales of the two neighbours of the hovered item and
+//! delivers scale updates to the items of a layout. Items register themselves
+//! with their index so a scale update reaches only the item that it is meant
+//! for, instead of being broadcasted to every item and filtered there. Clearing
+//! the zoom is done in a single pass that touches only the items that are not
+//! already restored. Which index receives which scale, e.g. when separators,
+//! hidden tasks or applets outside the tasks plasmoid are involved, is still
+//! decided by ParabolicManager.qml and no scales model is published.
+class ParabolicEngine : public QObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY(qreal zoomFactor READ zoomFactor WRITE setZoomFactor NOTIFY zoomFactorChanged)
+
+public:
+    ParabolicEngine(QObject *parent = nullptr);
+    ~ParabolicEngine() override;
+
+    qreal zoomFactor() const;
+    void setZoomFactor(qreal factor);
+
+public slots:
+    //! the item must provide a signalUpdateScale(index, scale, step) function
+    //! and a real property with the given name that holds its current scale
+    Q_INVOKABLE void registerItem(int index, QQuickItem *item, const QString &scaleProperty);
+    Q_INVOKABLE void unregisterItem(QQuickItem *item);
+
+    //! the scales of the hovered item neighbours as {leftScale, rightScale}
+    Q_INVOKABLE QVariantMap neighbourScales(qreal currentMousePosition, qreal center, bool reversed) const;
+
+    Q_INVOKABLE void updateScale(int index, qreal scale, qreal step);
+
+    //! restore the scale of all the items with index greater/lower than the given one
+    Q_INVOKABLE void clearScalesGreaterThan(int index);
+    Q_INVOKABLE void clearScalesLowerThan(int index);
+
+signals:
+    void zoomFactorChanged();
+
+private slots:
+    void itemDestroyed(QObject *item);
+
+private:
+    struct Entry {
+        QPointer<QQuickItem> item;
+        QMetaMethod updateScale;
+        QMetaProperty scale;
+        //! the last scale that was delivered through the engine
+        qreal deliveredScale{1};
+    };
+
+    bool isRestored(const Entry &entry) const;
+
+    void clearScales(const QList<int> &indexes);
+    void deliver(int index, Entry &entry, qreal scale, qreal step);
+
+private:
+    qreal m_zoomFactor{1};
+
+    QHash<int, Entry> m_entries;
+    QHash<QObject *, int> m_indexes;
+};
+
+}
+
+#endif
@@ -21,6 +21,8 @@
 
 // local
 #include "commontools.h"
+#include "statistics.h"
+#include "tracer.h"
 
 // Qt
 #include <QDebug>
@@ -242,6 +244,8 @@ bool BackgroundCache::areaIsBusy(float bright1, float bright2)
 //! subareas. If the difference it too big then the area is busy
 void BackgroundCache::updateImageCalculations(QString imageFile, Plasma::Types::Location location)
 {
+    LATTE_TRACE_SCOPE("plugin", "BackgroundCache::updateImageCalculations");
+
     //! if it is a local image
     QImage image(imageFile);
 
@@ -347,6 +351,7 @@ float BackgroundCache::brightnessForFile(QString imageFile, Plasma::Types::Locat
 {
     if (m_hintsCache.keys().contains(imageFile)) {
         if (m_hintsCache[imageFile].keys().contains(location)) {
+            LATTE_COUNT(BackgroundHintsHits);
             return m_hintsCache[imageFile][location].brightness;
         }
     }
@@ -356,6 +361,7 @@ float BackgroundCache::brightnessForFile(QString imageFile, Plasma::Types::Locat
         return Latte::colorBrightness(QColor(imageFile));
     }
 
+    LATTE_COUNT(BackgroundHintsMisses);
     updateImageCalculations(imageFile, location);
 
     if (m_hintsCache.keys().contains(imageFile)) {
@@ -369,6 +375,7 @@ bool BackgroundCache::busyForFile(QString imageFile, Plasma::Types::Location loc
 {
     if (m_hintsCache.keys().contains(imageFile)) {
         if (m_hintsCache[imageFile].keys().contains(location)) {
+            LATTE_COUNT(BackgroundHintsHits);
             return m_hintsCache[imageFile][location].busy;
         }
     }
@@ -378,6 +385,7 @@ bool BackgroundCache::busyForFile(QString imageFile, Plasma::Types::Location loc
         return false;
     }
 
+    LATTE_COUNT(BackgroundHintsMisses);
     updateImageCalculations(imageFile, location);
 
     if (m_hintsCache.keys().contains(imageFile)) {
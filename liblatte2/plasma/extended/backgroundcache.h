@@ -42,6 +42,8 @@ struct imageHints {
 typedef QHash<Plasma::Types::Location, imageHints> EdgesHash;
 
 namespace Latte {
+class Benchmarks;
+
 namespace PlasmaExtended {
 
 class BackgroundCache: public QObject
@@ -88,6 +90,8 @@ private:
     QHash<QString, EdgesHash> m_hintsCache;
 
     KSharedConfig::Ptr m_plasmaConfig;
+
+    friend class Latte::Benchmarks;
 };
 
 }
@@ -29,6 +29,7 @@ Item{
     //   property string color
     id: glowItem
 
+    property bool animationsPaused: false
     property bool glow3D: true
     property bool roundCorners: true
     property bool showBorder: false
@@ -247,6 +248,7 @@ Item{
 
                 SequentialAnimation{
                     running: glowItem.showAttention
+                    paused: running && glowItem.animationsPaused
                     loops: Animation.Infinite
                     alwaysRunToEnd: true
 
@@ -0,0 +1,1155 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "sharedtasksmodel.h"
+
+// Qt
+#include <QDebug>
+#include <QHash>
+#include <QList>
+#include <QMetaObject>
+
+// Plasma
+#include <taskmanager/tasksmodel.h>
+
+namespace Latte {
+
+namespace {
+const QString NULL_UUID = QStringLiteral("00000000-0000-0000-0000-000000000000");
+
+struct PooledModel {
+    TaskManager::TasksModel *model{nullptr};
+    QList<SharedTasksModel *> users;
+};
+
+//! all the tasks plasmoids of the process are loaded through the same plugin
+QHash<QString, PooledModel> &modelsPool()
+{
+    static QHash<QString, PooledModel> s_pool;
+    return s_pool;
+}
+
+//! the plasmoid whose call is changing the launchers of its model, the
+//! model reports the change synchronously during that call
+SharedTasksModel *s_launchersInitiator{nullptr};
+
+class LaunchersInitiator
+{
+public:
+    LaunchersInitiator(SharedTasksModel *initiator)
+        : m_previous(s_launchersInitiator)
+    {
+        s_launchersInitiator = initiator;
+    }
+
+    ~LaunchersInitiator()
+    {
+        s_launchersInitiator = m_previous;
+    }
+
+private:
+    SharedTasksModel *m_previous{nullptr};
+};
+}
+
+SharedTasksModel::SharedTasksModel(QObject *parent)
+    : QSortFilterProxyModel(parent)
+{
+    //! the filter is updated explicitly, a task can be accepted because of
+    //! its children or hidden because of its siblings
+    setDynamicSortFilter(false);
+
+    connect(this, &QAbstractItemModel::rowsInserted, this, &SharedTasksModel::onRowsChanged);
+    connect(this, &QAbstractItemModel::rowsRemoved, this, &SharedTasksModel::onRowsChanged);
+    connect(this, &QAbstractItemModel::layoutChanged, this, &SharedTasksModel::updateCount);
+    connect(this, &QAbstractItemModel::modelReset, this, &SharedTasksModel::updateCount);
+
+    connect(this, &QAbstractItemModel::dataChanged, this, [&](const QModelIndex &, const QModelIndex &, const QVector<int> &roles) {
+        if (roles.isEmpty() || roles.contains(m_roles.isDemandingAttention)) {
+            updateAnyTaskDemandsAttention();
+        }
+    });
+}
+
+SharedTasksModel::~SharedTasksModel()
+{
+    release();
+}
+
+bool SharedTasksModel::anyTaskDemandsAttention() const
+{
+    return m_anyTaskDemandsAttention;
+}
+
+bool SharedTasksModel::filterByActivity() const
+{
+    return m_filterByActivity;
+}
+
+void SharedTasksModel::setFilterByActivity(bool filter)
+{
+    if (m_filterByActivity == filter) {
+        return;
+    }
+
+    m_filterByActivity = filter;
+    invalidateTasksFilter();
+
+    emit filterByActivityChanged();
+}
+
+bool SharedTasksModel::filterByScreen() const
+{
+    return m_filterByScreen;
+}
+
+void SharedTasksModel::setFilterByScreen(bool filter)
+{
+    if (m_filterByScreen == filter) {
+        return;
+    }
+
+    m_filterByScreen = filter;
+    invalidateTasksFilter();
+
+    emit filterByScreenChanged();
+}
+
+bool SharedTasksModel::filterByVirtualDesktop() const
+{
+    return m_filterByVirtualDesktop;
+}
+
+void SharedTasksModel::setFilterByVirtualDesktop(bool filter)
+{
+    if (m_filterByVirtualDesktop == filter) {
+        return;
+    }
+
+    m_filterByVirtualDesktop = filter;
+    invalidateTasksFilter();
+
+    emit filterByVirtualDesktopChanged();
+}
+
+int SharedTasksModel::count() const
+{
+    return m_count;
+}
+
+int SharedTasksModel::launcherCount() const
+{
+    return m_model ? m_model->launcherCount() : 0;
+}
+
+int SharedTasksModel::sortMode() const
+{
+    return m_model ? (int)m_model->sortMode() : m_settings.value(QStringLiteral("sortMode")).toInt();
+}
+
+QString SharedTasksModel::activity() const
+{
+    return m_activity;
+}
+
+void SharedTasksModel::setActivity(QString activity)
+{
+    if (m_activity == activity) {
+        return;
+    }
+
+    m_activity = activity;
+
+    if (m_model) {
+        applyCurrentState(m_model);
+    }
+
+    if (m_filterByActivity) {
+        invalidateTasksFilter();
+    }
+
+    emit activityChanged();
+}
+
+QString SharedTasksModel::sharingKey() const
+{
+    return m_sharingKey;
+}
+
+void SharedTasksModel::setSharingKey(QString key)
+{
+    if (m_sharingKey == key) {
+        return;
+    }
+
+    m_sharingKey = key;
+    emit sharingKeyChanged();
+
+    updateModel();
+}
+
+QStringList SharedTasksModel::groupingAppIdBlacklist() const
+{
+    return m_model ? m_model->groupingAppIdBlacklist() : m_groupingAppIdBlacklist;
+}
+
+void SharedTasksModel::setGroupingAppIdBlacklist(QStringList list)
+{
+    if (groupingAppIdBlacklist() == list) {
+        return;
+    }
+
+    m_groupingAppIdBlacklist = list;
+
+    if (m_model) {
+        //! the model reports the change to all the plasmoids that share it
+        m_model->setGroupingAppIdBlacklist(list);
+    } else {
+        emit groupingAppIdBlacklistChanged();
+    }
+}
+
+QStringList SharedTasksModel::groupingLauncherUrlBlacklist() const
+{
+    return m_model ? m_model->groupingLauncherUrlBlacklist() : m_groupingLauncherUrlBlacklist;
+}
+
+void SharedTasksModel::setGroupingLauncherUrlBlacklist(QStringList list)
+{
+    if (groupingLauncherUrlBlacklist() == list) {
+        return;
+    }
+
+    m_groupingLauncherUrlBlacklist = list;
+
+    if (m_model) {
+        m_model->setGroupingLauncherUrlBlacklist(list);
+    } else {
+        emit groupingLauncherUrlBlacklistChanged();
+    }
+}
+
+QStringList SharedTasksModel::launcherList() const
+{
+    return m_model ? m_model->launcherList() : QStringList();
+}
+
+void SharedTasksModel::setLauncherList(QStringList launchers)
+{
+    if (!m_model) {
+        return;
+    }
+
+    LaunchersInitiator initiator(this);
+    m_model->setLauncherList(launchers);
+}
+
+QRect SharedTasksModel::screenGeometry() const
+{
+    return m_screenGeometry;
+}
+
+void SharedTasksModel::setScreenGeometry(QRect geometry)
+{
+    if (m_screenGeometry == geometry) {
+        return;
+    }
+
+    m_screenGeometry = geometry;
+
+    if (m_filterByScreen) {
+        invalidateTasksFilter();
+    }
+
+    emit screenGeometryChanged();
+}
+
+QVariant SharedTasksModel::virtualDesktop() const
+{
+    return m_virtualDesktop;
+}
+
+void SharedTasksModel::setVirtualDesktop(QVariant desktop)
+{
+    if (m_virtualDesktop == desktop) {
+        return;
+    }
+
+    m_virtualDesktop = desktop;
+
+    if (m_model) {
+        applyCurrentState(m_model);
+    }
+
+    if (m_filterByVirtualDesktop) {
+        invalidateTasksFilter();
+    }
+
+    emit virtualDesktopChanged();
+}
+
+QVariantMap SharedTasksModel::settings() const
+{
+    return m_settings;
+}
+
+void SharedTasksModel::setSettings(QVariantMap settings)
+{
+    if (m_settings == settings) {
+        return;
+    }
+
+    m_settings = settings;
+    emit settingsChanged();
+
+    updateModel();
+}
+
+QModelIndex SharedTasksModel::activeTask() const
+{
+    if (!m_model) {
+        return QModelIndex();
+    }
+
+    QModelIndex sourceIndex = m_model->activeTask();
+
+    if (!sourceIndex.isValid() || isLauncherSlot(sourceIndex)) {
+        return QModelIndex();
+    }
+
+    return mapFromSource(sourceIndex);
+}
+
+QVariant SharedTasksModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || !m_model || !isFiltering() || index.parent().isValid()) {
+        return QSortFilterProxyModel::data(index, role);
+    }
+
+    bool stateRole = (role == m_roles.isLauncher || role == m_roles.isWindow || role == m_roles.isStartup
+                      || role == m_roles.isGroupParent || role == m_roles.isActive || role == m_roles.isMinimized
+                      || role == m_roles.isDemandingAttention);
+    bool windowsRole = (role == m_roles.childCount || role == m_roles.winIdList || role == m_roles.legacyWinIdList);
+
+    if (!stateRole && !windowsRole) {
+        return QSortFilterProxyModel::data(index, role);
+    }
+
+    QModelIndex sourceIndex = mapToSource(index);
+
+    if (isLauncherSlot(sourceIndex)) {
+        if (role == m_roles.isLauncher) {
+            return true;
+        } else if (role == m_roles.childCount) {
+            return 0;
+        } else if (windowsRole) {
+            return QVariantList();
+        }
+
+        return false;
+    }
+
+    //! groups report only the windows that pass the filter
+    if (windowsRole && m_model->rowCount(sourceIndex) > 0) {
+        if (role == m_roles.childCount) {
+            return rowCount(index);
+        }
+
+        QVariantList winIds;
+
+        for (int row = 0; row < rowCount(index); ++row) {
+            winIds.append(QSortFilterProxyModel::data(this->index(row, 0, index), role).toList());
+        }
+
+        return winIds;
+    }
+
+    return QSortFilterProxyModel::data(index, role);
+}
+
+bool SharedTasksModel::hasChildren(const QModelIndex &parent) const
+{
+    if (parent.isValid()) {
+        return rowCount(parent) > 0;
+    }
+
+    return QSortFilterProxyModel::hasChildren(parent);
+}
+
+void SharedTasksModel::classBegin()
+{
+}
+
+void SharedTasksModel::componentComplete()
+{
+    m_componentComplete = true;
+
+    updateModel();
+}
+
+QModelIndex SharedTasksModel::makeModelIndex(int row, int childRow) const
+{
+    QModelIndex parent = index(row, 0);
+
+    if (childRow < 0 || !parent.isValid()) {
+        return parent;
+    }
+
+    return index(childRow, 0, parent);
+}
+
+int SharedTasksModel::launcherPosition(const QUrl &url) const
+{
+    return m_model ? m_model->launcherPosition(url) : -1;
+}
+
+QStringList SharedTasksModel::launcherActivities(const QUrl &url) const
+{
+    return m_model ? m_model->launcherActivities(url) : QStringList();
+}
+
+bool SharedTasksModel::requestAddLauncher(const QUrl &url)
+{
+    if (!m_model) {
+        return false;
+    }
+
+    LaunchersInitiator initiator(this);
+    return m_model->requestAddLauncher(url);
+}
+
+bool SharedTasksModel::requestRemoveLauncher(const QUrl &url)
+{
+    if (!m_model) {
+        return false;
+    }
+
+    LaunchersInitiator initiator(this);
+    return m_model->requestRemoveLauncher(url);
+}
+
+bool SharedTasksModel::requestAddLauncherToActivity(const QUrl &url, const QString &activity)
+{
+    if (!m_model) {
+        return false;
+    }
+
+    LaunchersInitiator initiator(this);
+    return m_model->requestAddLauncherToActivity(url, activity);
+}
+
+bool SharedTasksModel::requestRemoveLauncherFromActivity(const QUrl &url, const QString &activity)
+{
+    if (!m_model) {
+        return false;
+    }
+
+    LaunchersInitiator initiator(this);
+    return m_model->requestRemoveLauncherFromActivity(url, activity);
+}
+
+void SharedTasksModel::syncLaunchers()
+{
+    if (!m_model) {
+        return;
+    }
+
+    LaunchersInitiator initiator(this);
+    m_model->syncLaunchers();
+}
+
+bool SharedTasksModel::move(int row, int newPos)
+{
+    QModelIndex sourceIndex = mapToSource(index(row, 0));
+    QModelIndex sourceTarget = mapToSource(index(newPos, 0));
+
+    if (!m_model || !sourceIndex.isValid() || !sourceTarget.isValid()) {
+        return false;
+    }
+
+    LaunchersInitiator initiator(this);
+    return m_model->move(sourceIndex.row(), sourceTarget.row());
+}
+
+void SharedTasksModel::requestActivate(const QModelIndex &index)
+{
+    if (!m_model) {
+        return;
+    }
+
+    QModelIndex sourceIndex = sourceTaskIndex(index);
+
+    //! a launcher that is shown in place of filtered windows starts a new instance
+    if (isLauncherSlot(sourceIndex)) {
+        m_model->requestNewInstance(sourceIndex);
+    } else {
+        m_model->requestActivate(sourceIndex);
+    }
+}
+
+void SharedTasksModel::requestNewInstance(const QModelIndex &index)
+{
+    if (m_model) {
+        m_model->requestNewInstance(sourceTaskIndex(index));
+    }
+}
+
+void SharedTasksModel::requestOpenUrls(const QModelIndex &index, const QList<QUrl> &urls)
+{
+    if (m_model) {
+        m_model->requestOpenUrls(sourceTaskIndex(index), urls);
+    }
+}
+
+void SharedTasksModel::requestClose(const QModelIndex &index)
+{
+    if (m_model) {
+        m_model->requestClose(windowIndex(index));
+    }
+}
+
+void SharedTasksModel::requestMove(const QModelIndex &index)
+{
+    if (m_model) {
+        m_model->requestMove(windowIndex(index));
+    }
+}
+
+void SharedTasksModel::requestResize(const QModelIndex &index)
+{
+    if (m_model) {
+        m_model->requestResize(windowIndex(index));
+    }
+}
+
+void SharedTasksModel::requestToggleMinimized(const QModelIndex &index)
+{
+    if (m_model) {
+        m_model->requestToggleMinimized(windowIndex(index));
+    }
+}
+
+void SharedTasksModel::requestToggleMaximized(const QModelIndex &index)
+{
+    if (m_model) {
+        m_model->requestToggleMaximized(windowIndex(index));
+    }
+}
+
+void SharedTasksModel::requestToggleKeepAbove(const QModelIndex &index)
+{
+    if (m_model) {
+        m_model->requestToggleKeepAbove(windowIndex(index));
+    }
+}
+
+void SharedTasksModel::requestToggleKeepBelow(const QModelIndex &index)
+{
+    if (m_model) {
+        m_model->requestToggleKeepBelow(windowIndex(index));
+    }
+}
+
+void SharedTasksModel::requestToggleFullScreen(const QModelIndex &index)
+{
+    if (m_model) {
+        m_model->requestToggleFullScreen(windowIndex(index));
+    }
+}
+
+void SharedTasksModel::requestToggleShaded(const QModelIndex &index)
+{
+    if (m_model) {
+        m_model->requestToggleShaded(windowIndex(index));
+    }
+}
+
+void SharedTasksModel::requestToggleGrouping(const QModelIndex &index)
+{
+    if (m_model) {
+        m_model->requestToggleGrouping(windowIndex(index));
+    }
+}
+
+void SharedTasksModel::requestActivities(const QModelIndex &index, const QStringList &activities)
+{
+    if (m_model) {
+        m_model->requestActivities(windowIndex(index), activities);
+    }
+}
+
+void SharedTasksModel::requestPublishDelegateGeometry(const QModelIndex &index, const QRect &geometry, QObject *delegate)
+{
+    if (m_model) {
+        m_model->requestPublishDelegateGeometry(windowIndex(index), geometry, delegate);
+    }
+}
+
+void SharedTasksModel::requestVirtualDesktop(const QModelIndex &index, int desktop)
+{
+    if (m_model) {
+        QMetaObject::invokeMethod(m_model, "requestVirtualDesktop",
+                                  Q_ARG(QModelIndex, windowIndex(index)), Q_ARG(qint32, desktop));
+    }
+}
+
+void SharedTasksModel::requestVirtualDesktops(const QModelIndex &index, const QVariantList &desktops)
+{
+    if (m_model) {
+        QMetaObject::invokeMethod(m_model, "requestVirtualDesktops",
+                                  Q_ARG(QModelIndex, windowIndex(index)), Q_ARG(QVariantList, desktops));
+    }
+}
+
+void SharedTasksModel::requestNewVirtualDesktop(const QModelIndex &index)
+{
+    if (m_model) {
+        QMetaObject::invokeMethod(m_model, "requestNewVirtualDesktop", Q_ARG(QModelIndex, windowIndex(index)));
+    }
+}
+
+bool SharedTasksModel::filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const
+{
+    if (!m_model || !isFiltering()) {
+        return true;
+    }
+
+    QModelIndex sourceIndex = m_model->index(sourceRow, 0, sourceParent);
+
+    if (sourceParent.isValid()) {
+        return acceptsTask(sourceIndex);
+    }
+
+    return acceptsEntry(sourceIndex) || launcherTakesPlace(sourceIndex);
+}
+
+bool SharedTasksModel::acceptsEntry(const QModelIndex &sourceIndex) const
+{
+    int children = m_model->rowCount(sourceIndex);
+
+    if (children == 0) {
+        return acceptsTask(sourceIndex);
+    }
+
+    for (int row = 0; row < children; ++row) {
+        if (acceptsTask(m_model->index(row, 0, sourceIndex))) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool SharedTasksModel::acceptsTask(const QModelIndex &sourceIndex) const
+{
+    //! the same rules that TaskManager::TaskFilterProxyModel applies
+    if (m_filterByVirtualDesktop && !sourceIndex.data(m_roles.isOnAllVirtualDesktops).toBool()) {
+        if (m_roles.virtualDesktops >= 0 && !m_virtualDesktop.isNull()) {
+            const QVariantList desktops = sourceIndex.data(m_roles.virtualDesktops).toList();
+
+            if (!desktops.isEmpty() && !desktops.contains(m_virtualDesktop)) {
+                return false;
+            }
+        } else if (m_roles.virtualDesktop >= 0 && m_virtualDesktop.toUInt() != 0) {
+            bool ok{false};
+            uint desktop = sourceIndex.data(m_roles.virtualDesktop).toUInt(&ok);
+
+            if (ok && desktop != m_virtualDesktop.toUInt()) {
+                return false;
+            }
+        }
+    }
+
+    if (m_filterByScreen && m_screenGeometry.isValid()) {
+        const QRect screenGeometry = sourceIndex.data(m_roles.screenGeometry).toRect();
+
+        if (screenGeometry.isValid() && screenGeometry != m_screenGeometry) {
+            return false;
+        }
+    }
+
+    if (m_filterByActivity && !m_activity.isEmpty()) {
+        const QStringList activities = sourceIndex.data(m_roles.activities).toStringList();
+
+        if (!activities.isEmpty() && !activities.contains(NULL_UUID) && !activities.contains(m_activity)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool SharedTasksModel::filterIsCurrent(const QModelIndex &sourceIndex) const
+{
+    QModelIndex proxyIndex = mapFromSource(sourceIndex);
+    bool wasAccepted = proxyIndex.isValid() && !m_launcherSlots.contains(sourceIndex);
+
+    //! a changed entry can also hide or show the launcher of its siblings
+    if (acceptsEntry(sourceIndex) != wasAccepted) {
+        return false;
+    }
+
+    if (!wasAccepted) {
+        return true;
+    }
+
+    for (int row = 0; row < m_model->rowCount(sourceIndex); ++row) {
+        QModelIndex child = m_model->index(row, 0, sourceIndex);
+
+        if (acceptsTask(child) != mapFromSource(child).isValid()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool SharedTasksModel::isFiltering() const
+{
+    return m_filterByVirtualDesktop || m_filterByScreen || m_filterByActivity;
+}
+
+bool SharedTasksModel::isLauncherSlot(const QModelIndex &sourceIndex) const
+{
+    //! it is valid only for shared model rows that this model shows
+    return m_model && isFiltering() && sourceIndex.isValid() && !sourceIndex.parent().isValid()
+           && !sourceIndex.data(m_roles.isLauncher).toBool() && !acceptsEntry(sourceIndex);
+}
+
+bool SharedTasksModel::launcherTakesPlace(const QModelIndex &sourceIndex) const
+{
+    //! the shared model places the windows of a launcher at its position and
+    //! hides the launcher, when none of these windows passes the filter the
+    //! launcher is shown again like TasksModel does when it filters the windows
+    if (sourceIndex.data(m_roles.isLauncher).toBool()) {
+        return false;
+    }
+
+    const QUrl url = sourceIndex.data(m_roles.launcherUrlWithoutIcon).toUrl();
+
+    if (url.isEmpty() || m_model->launcherPosition(url) < 0) {
+        return false;
+    }
+
+    const QStringList activities = m_model->launcherActivities(url);
+
+    if (!activities.isEmpty() && !activities.contains(NULL_UUID) && !activities.contains(m_activity)) {
+        return false;
+    }
+
+    for (int row = 0; row < m_model->rowCount(); ++row) {
+        QModelIndex sibling = m_model->index(row, 0);
+
+        if (row == sourceIndex.row() || sibling.data(m_roles.launcherUrlWithoutIcon).toUrl() != url) {
+            continue;
+        }
+
+        //! a single launcher is shown for all the windows of the same launcher
+        if (row < sourceIndex.row() || acceptsEntry(sibling)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool SharedTasksModel::persistsLaunchers() const
+{
+    if (s_launchersInitiator) {
+        return s_launchersInitiator == this;
+    }
+
+    if (m_poolKey.isEmpty()) {
+        return true;
+    }
+
+    const QList<SharedTasksModel *> users = modelsPool().value(m_poolKey).users;
+
+    return users.isEmpty() || users.first() == this;
+}
+
+void SharedTasksModel::onLauncherListChanged()
+{
+    if (isFiltering()) {
+        invalidateTasksFilter();
+    }
+
+    emit launcherListChanged();
+
+    if (persistsLaunchers()) {
+        emit persistLaunchersRequested();
+    }
+}
+
+void SharedTasksModel::onRowsChanged(const QModelIndex &parent)
+{
+    if (parent.isValid()) {
+        QVector<int> roles;
+
+        for (int role : {m_roles.childCount, m_roles.winIdList, m_roles.legacyWinIdList}) {
+            if (role >= 0) {
+                roles << role;
+            }
+        }
+
+        emit dataChanged(parent, parent, roles);
+        return;
+    }
+
+    updateCount();
+}
+
+void SharedTasksModel::onSourceDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QVector<int> &roles)
+{
+    if (!m_model || !isFiltering()) {
+        return;
+    }
+
+    if (!roles.isEmpty()) {
+        bool filterRoles{false};
+
+        for (int role : {m_roles.activities, m_roles.isOnAllVirtualDesktops, m_roles.screenGeometry,
+                         m_roles.virtualDesktop, m_roles.virtualDesktops}) {
+            if (role >= 0 && roles.contains(role)) {
+                filterRoles = true;
+                break;
+            }
+        }
+
+        if (!filterRoles) {
+            return;
+        }
+    }
+
+    QModelIndex sourceParent = topLeft.parent();
+
+    //! the children of a group are checked together with their parent
+    if (sourceParent.isValid()) {
+        if (!filterIsCurrent(sourceParent)) {
+            invalidateTasksFilter();
+        }
+
+        return;
+    }
+
+    for (int row = topLeft.row(); row <= bottomRight.row(); ++row) {
+        if (!filterIsCurrent(m_model->index(row, 0))) {
+            invalidateTasksFilter();
+            return;
+        }
+    }
+}
+
+void SharedTasksModel::onSourceRowsChanged()
+{
+    if (isFiltering()) {
+        invalidateTasksFilter();
+    }
+}
+
+void SharedTasksModel::updateAnyTaskDemandsAttention()
+{
+    bool demandsAttention{false};
+
+    if (m_model && m_model->anyTaskDemandsAttention()) {
+        if (!isFiltering()) {
+            demandsAttention = true;
+        } else {
+            for (int row = 0; row < rowCount(); ++row) {
+                if (data(index(row, 0), m_roles.isDemandingAttention).toBool()) {
+                    demandsAttention = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    if (m_anyTaskDemandsAttention == demandsAttention) {
+        return;
+    }
+
+    m_anyTaskDemandsAttention = demandsAttention;
+    emit anyTaskDemandsAttentionChanged();
+}
+
+void SharedTasksModel::updateCount()
+{
+    int count = rowCount();
+
+    if (count != m_count) {
+        m_count = count;
+        emit countChanged();
+    }
+
+    updateAnyTaskDemandsAttention();
+}
+
+void SharedTasksModel::applyBlacklists(TaskManager::TasksModel *model) const
+{
+    model->setGroupingAppIdBlacklist(m_groupingAppIdBlacklist);
+    model->setGroupingLauncherUrlBlacklist(m_groupingLauncherUrlBlacklist);
+}
+
+void SharedTasksModel::applyCurrentState(TaskManager::TasksModel *model) const
+{
+    if (m_virtualDesktop.isValid()) {
+        model->setProperty("virtualDesktop", m_virtualDesktop);
+    }
+
+    model->setActivity(m_activity);
+}
+
+void SharedTasksModel::applySettings(TaskManager::TasksModel *model) const
+{
+    for (auto it = m_settings.constBegin(); it != m_settings.constEnd(); ++it) {
+        const QByteArray name = it.key().toUtf8();
+
+        //! setProperty would create a dynamic property for unknown names
+        if (model->metaObject()->indexOfProperty(name.constData()) < 0) {
+            qWarning() << "Tasks model has no property ::: " << it.key();
+            continue;
+        }
+
+        model->setProperty(name.constData(), it.value());
+    }
+}
+
+void SharedTasksModel::connectModel()
+{
+    connect(m_model, &TaskManager::TasksModel::launcherListChanged, this, &SharedTasksModel::onLauncherListChanged);
+    connect(m_model, &TaskManager::TasksModel::launcherCountChanged, this, &SharedTasksModel::launcherCountChanged);
+    connect(m_model, &TaskManager::TasksModel::groupingAppIdBlacklistChanged, this, &SharedTasksModel::groupingAppIdBlacklistChanged);
+    connect(m_model, &TaskManager::TasksModel::groupingLauncherUrlBlacklistChanged, this, &SharedTasksModel::groupingLauncherUrlBlacklistChanged);
+    connect(m_model, &TaskManager::TasksModel::activeTaskChanged, this, &SharedTasksModel::activeTaskChanged);
+    connect(m_model, &TaskManager::TasksModel::anyTaskDemandsAttentionChanged, this, &SharedTasksModel::updateAnyTaskDemandsAttention);
+
+    //! connected after the proxy own connections, the proxy has already processed each change
+    connect(m_model, &QAbstractItemModel::dataChanged, this, &SharedTasksModel::onSourceDataChanged);
+    connect(m_model, &QAbstractItemModel::rowsInserted, this, &SharedTasksModel::onSourceRowsChanged);
+    connect(m_model, &QAbstractItemModel::rowsRemoved, this, &SharedTasksModel::onSourceRowsChanged);
+    connect(m_model, &QAbstractItemModel::rowsMoved, this, &SharedTasksModel::onSourceRowsChanged);
+    connect(m_model, &QAbstractItemModel::layoutChanged, this, &SharedTasksModel::onSourceRowsChanged);
+}
+
+void SharedTasksModel::invalidateTasksFilter()
+{
+    invalidateFilter();
+    updateLauncherSlots();
+}
+
+void SharedTasksModel::release()
+{
+    if (!m_model) {
+        return;
+    }
+
+    TaskManager::TasksModel *model = m_model;
+    m_model = nullptr;
+    m_launcherSlots.clear();
+
+    disconnect(model, nullptr, this, nullptr);
+
+    if (!m_poolKey.isEmpty()) {
+        QHash<QString, PooledModel> &pool = modelsPool();
+        auto pooled = pool.find(m_poolKey);
+
+        m_poolKey.clear();
+
+        if (pooled != pool.end()) {
+            pooled->users.removeAll(this);
+
+            if (!pooled->users.isEmpty()) {
+                return;
+            }
+
+            pool.erase(pooled);
+        }
+    }
+
+    //! the model can be released while it is emitting one of its signals
+    model->deleteLater();
+}
+
+void SharedTasksModel::updateLauncherSlots()
+{
+    QSet<QPersistentModelIndex> launcherSlots;
+
+    for (int row = 0; row < rowCount(); ++row) {
+        QModelIndex proxyIndex = index(row, 0);
+        QModelIndex sourceIndex = mapToSource(proxyIndex);
+        bool isSlot = isLauncherSlot(sourceIndex);
+
+        if (isSlot) {
+            launcherSlots.insert(sourceIndex);
+        }
+
+        //! the row stays in the model but its task changes between a window and a launcher
+        if (isSlot != m_launcherSlots.contains(sourceIndex)) {
+            emit dataChanged(proxyIndex, proxyIndex);
+        }
+    }
+
+    m_launcherSlots = launcherSlots;
+}
+
+void SharedTasksModel::updateModel()
+{
+    if (!m_componentComplete) {
+        return;
+    }
+
+    QHash<QString, PooledModel> &pool = modelsPool();
+    QString key = poolKey();
+
+    if (m_model) {
+        if (!key.isEmpty() && key == m_poolKey) {
+            return;
+        }
+
+        bool onlyUser = m_poolKey.isEmpty() || pool.value(m_poolKey).users.count() == 1;
+
+        //! a model that no other plasmoid is using is updated in place,
+        //! this way the plasmoid does not recreate its tasks
+        if (onlyUser && (key.isEmpty() || !pool.contains(key))) {
+            if (!m_poolKey.isEmpty()) {
+                PooledModel pooled = pool.take(m_poolKey);
+
+                if (!key.isEmpty()) {
+                    pool[key] = pooled;
+                }
+            }
+
+            m_poolKey = key;
+            applySettings(m_model);
+            return;
+        }
+
+        release();
+    }
+
+    TaskManager::TasksModel *model{nullptr};
+    bool created{true};
+
+    if (key.isEmpty()) {
+        model = new TaskManager::TasksModel();
+    } else {
+        PooledModel &pooled = pool[key];
+
+        if (pooled.model) {
+            created = false;
+        } else {
+            pooled.model = new TaskManager::TasksModel();
+        }
+
+        pooled.users.append(this);
+        model = pooled.model;
+    }
+
+    //! a plasmoid that joins a shared model adopts its grouping blacklists
+    if (created) {
+        applySettings(model);
+        applyBlacklists(model);
+    }
+
+    applyCurrentState(model);
+
+    bool blacklistsChanged = (model->groupingAppIdBlacklist() != m_groupingAppIdBlacklist
+                              || model->groupingLauncherUrlBlacklist() != m_groupingLauncherUrlBlacklist);
+
+    m_model = model;
+    m_poolKey = key;
+
+    updateRoles();
+    setSourceModel(model);
+    connectModel();
+
+    updateLauncherSlots();
+    updateCount();
+
+    emit activeTaskChanged();
+    emit launcherCountChanged();
+    emit launcherListChanged();
+
+    if (blacklistsChanged) {
+        emit groupingAppIdBlacklistChanged();
+        emit groupingLauncherUrlBlacklistChanged();
+    }
+}
+
+void SharedTasksModel::updateRoles()
+{
+    const QHash<int, QByteArray> roleNames = m_model->roleNames();
+
+    auto role = [&roleNames](const char *name) {
+        return roleNames.key(QByteArray(name), -1);
+    };
+
+    m_roles.activities = role("Activities");
+    m_roles.childCount = role("ChildCount");
+    m_roles.isActive = role("IsActive");
+    m_roles.isDemandingAttention = role("IsDemandingAttention");
+    m_roles.isGroupParent = role("IsGroupParent");
+    m_roles.isLauncher = role("IsLauncher");
+    m_roles.isMinimized = role("IsMinimized");
+    m_roles.isOnAllVirtualDesktops = role("IsOnAllVirtualDesktops");
+    m_roles.isStartup = role("IsStartup");
+    m_roles.isWindow = role("IsWindow");
+    m_roles.launcherUrlWithoutIcon = role("LauncherUrlWithoutIcon");
+    m_roles.legacyWinIdList = role("LegacyWinIdList");
+    m_roles.screenGeometry = role("ScreenGeometry");
+    m_roles.virtualDesktop = role("VirtualDesktop");
+    m_roles.virtualDesktops = role("VirtualDesktops");
+    m_roles.winIdList = role("WinIdList");
+}
+
+QModelIndex SharedTasksModel::sourceTaskIndex(const QModelIndex &index) const
+{
+    if (!m_model || !index.isValid() || index.model() != this) {
+        return QModelIndex();
+    }
+
+    return mapToSource(index);
+}
+
+QModelIndex SharedTasksModel::windowIndex(const QModelIndex &index) const
+{
+    QModelIndex sourceIndex = sourceTaskIndex(index);
+
+    //! a launcher that is shown in place of filtered windows has no windows to act on
+    return isLauncherSlot(sourceIndex) ? QModelIndex() : sourceIndex;
+}
+
+QString SharedTasksModel::poolKey() const
+{
+    if (m_sharingKey.isEmpty()) {
+        return QString();
+    }
+
+    QString key = m_sharingKey;
+
+    //! QVariantMap is sorted, identical settings always produce the same key
+    for (auto it = m_settings.constBegin(); it != m_settings.constEnd(); ++it) {
+        key += QLatin1Char('|') + it.key() + QLatin1Char('=') + it.value().toString();
+    }
+
+    return key;
+}
+
+}
@@ -0,0 +1,281 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef SHAREDTASKSMODEL_H
+#define SHAREDTASKSMODEL_H
+
+// Qt
+#include <QModelIndex>
+#include <QPersistentModelIndex>
+#include <QPointer>
+#include <QQmlParserStatus>
+#include <QRect>
+#include <QSet>
+#include <QSortFilterProxyModel>
+#include <QStringList>
+#include <QUrl>
+#include <QVariantMap>
+#include <QVector>
+
+namespace TaskManager {
+class TasksModel;
+}
+
+namespace Latte {
+
+//! It is the tasks model of a Latte tasks plasmoid. Plasmoids that show the
+//! same synced launchers with identical grouping and sorting settings share
+//! one unfiltered TaskManager::TasksModel, so each window event is grouped
+//! and sorted once for all of them. Each plasmoid filters the shared model
+//! on its own by virtual desktop, screen and activity with the rules of
+//! TaskManager::TasksModel. An empty sharingKey provides a model of its own.
+//!
+//! Because grouping happens before filtering, a group keeps only the windows
+//! that pass the filter and a launcher whose windows are all filtered out is
+//! shown again in their place. The TasksModel api that the plasmoid uses is
+//! forwarded with the indexes mapped to the shared model.
+class SharedTasksModel : public QSortFilterProxyModel, public QQmlParserStatus
+{
+    Q_OBJECT
+    Q_INTERFACES(QQmlParserStatus)
+
+    //! plasmoids with the same non-empty key show the same launchers
+    Q_PROPERTY(QString sharingKey READ sharingKey WRITE setSharingKey NOTIFY sharingKeyChanged)
+    //! grouping and sorting TasksModel properties that are applied to the shared
+    //! model, plasmoids share a model only when these settings are identical
+    Q_PROPERTY(QVariantMap settings READ settings WRITE setSettings NOTIFY settingsChanged)
+
+    Q_PROPERTY(int count READ count NOTIFY countChanged)
+    Q_PROPERTY(int sortMode READ sortMode NOTIFY settingsChanged)
+
+    Q_PROPERTY(bool filterByVirtualDesktop READ filterByVirtualDesktop WRITE setFilterByVirtualDesktop NOTIFY filterByVirtualDesktopChanged)
+    Q_PROPERTY(bool filterByScreen READ filterByScreen WRITE setFilterByScreen NOTIFY filterByScreenChanged)
+    Q_PROPERTY(bool filterByActivity READ filterByActivity WRITE setFilterByActivity NOTIFY filterByActivityChanged)
+    Q_PROPERTY(QRect screenGeometry READ screenGeometry WRITE setScreenGeometry NOTIFY screenGeometryChanged)
+
+    //! the current virtual desktop and activity are the same for all plasmoids,
+    //! they are applied also to the shared model that filters its launchers by activity
+    Q_PROPERTY(QVariant virtualDesktop READ virtualDesktop WRITE setVirtualDesktop NOTIFY virtualDesktopChanged)
+    Q_PROPERTY(QString activity READ activity WRITE setActivity NOTIFY activityChanged)
+
+    //! plasmoids that share a model share also its grouping blacklists
+    Q_PROPERTY(QStringList groupingAppIdBlacklist READ groupingAppIdBlacklist WRITE setGroupingAppIdBlacklist NOTIFY groupingAppIdBlacklistChanged)
+    Q_PROPERTY(QStringList groupingLauncherUrlBlacklist READ groupingLauncherUrlBlacklist WRITE setGroupingLauncherUrlBlacklist NOTIFY groupingLauncherUrlBlacklistChanged)
+
+    Q_PROPERTY(QStringList launcherList READ launcherList WRITE setLauncherList NOTIFY launcherListChanged)
+    Q_PROPERTY(int launcherCount READ launcherCount NOTIFY launcherCountChanged)
+
+    Q_PROPERTY(bool anyTaskDemandsAttention READ anyTaskDemandsAttention NOTIFY anyTaskDemandsAttentionChanged)
+    Q_PROPERTY(QModelIndex activeTask READ activeTask NOTIFY activeTaskChanged)
+
+public:
+    SharedTasksModel(QObject *parent = nullptr);
+    ~SharedTasksModel() override;
+
+    bool anyTaskDemandsAttention() const;
+
+    bool filterByActivity() const;
+    void setFilterByActivity(bool filter);
+
+    bool filterByScreen() const;
+    void setFilterByScreen(bool filter);
+
+    bool filterByVirtualDesktop() const;
+    void setFilterByVirtualDesktop(bool filter);
+
+    int count() const;
+    int launcherCount() const;
+    int sortMode() const;
+
+    QString activity() const;
+    void setActivity(QString activity);
+
+    QString sharingKey() const;
+    void setSharingKey(QString key);
+
+    QStringList groupingAppIdBlacklist() const;
+    void setGroupingAppIdBlacklist(QStringList list);
+
+    QStringList groupingLauncherUrlBlacklist() const;
+    void setGroupingLauncherUrlBlacklist(QStringList list);
+
+    QStringList launcherList() const;
+    void setLauncherList(QStringList launchers);
+
+    QRect screenGeometry() const;
+    void setScreenGeometry(QRect geometry);
+
+    QVariant virtualDesktop() const;
+    void setVirtualDesktop(QVariant desktop);
+
+    QVariantMap settings() const;
+    void setSettings(QVariantMap settings);
+
+    QModelIndex activeTask() const;
+
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    bool hasChildren(const QModelIndex &parent = QModelIndex()) const override;
+
+    void classBegin() override;
+    void componentComplete() override;
+
+    Q_INVOKABLE QModelIndex makeModelIndex(int row, int childRow = -1) const;
+
+    Q_INVOKABLE int launcherPosition(const QUrl &url) const;
+    Q_INVOKABLE QStringList launcherActivities(const QUrl &url) const;
+
+    Q_INVOKABLE bool requestAddLauncher(const QUrl &url);
+    Q_INVOKABLE bool requestRemoveLauncher(const QUrl &url);
+    Q_INVOKABLE bool requestAddLauncherToActivity(const QUrl &url, const QString &activity);
+    Q_INVOKABLE bool requestRemoveLauncherFromActivity(const QUrl &url, const QString &activity);
+    Q_INVOKABLE void syncLaunchers();
+    Q_INVOKABLE bool move(int row, int newPos);
+
+    Q_INVOKABLE void requestActivate(const QModelIndex &index);
+    Q_INVOKABLE void requestNewInstance(const QModelIndex &index);
+    Q_INVOKABLE void requestOpenUrls(const QModelIndex &index, const QList<QUrl> &urls);
+    Q_INVOKABLE void requestClose(const QModelIndex &index);
+    Q_INVOKABLE void requestMove(const QModelIndex &index);
+    Q_INVOKABLE void requestResize(const QModelIndex &index);
+    Q_INVOKABLE void requestToggleMinimized(const QModelIndex &index);
+    Q_INVOKABLE void requestToggleMaximized(const QModelIndex &index);
+    Q_INVOKABLE void requestToggleKeepAbove(const QModelIndex &index);
+    Q_INVOKABLE void requestToggleKeepBelow(const QModelIndex &index);
+    Q_INVOKABLE void requestToggleFullScreen(const QModelIndex &index);
+    Q_INVOKABLE void requestToggleShaded(const QModelIndex &index);
+    Q_INVOKABLE void requestToggleGrouping(const QModelIndex &index);
+    Q_INVOKABLE void requestActivities(const QModelIndex &index, const QStringList &activities);
+    Q_INVOKABLE void requestPublishDelegateGeometry(const QModelIndex &index, const QRect &geometry, QObject *delegate = nullptr);
+
+    //! the virtual desktops api of TasksModel differs between plasma versions,
+    //! each call is forwarded only when the running version provides it
+    Q_INVOKABLE void requestVirtualDesktop(const QModelIndex &index, int desktop);
+    Q_INVOKABLE void requestVirtualDesktops(const QModelIndex &index, const QVariantList &desktops);
+    Q_INVOKABLE void requestNewVirtualDesktop(const QModelIndex &index);
+
+signals:
+    void activeTaskChanged();
+    void activityChanged();
+    void anyTaskDemandsAttentionChanged();
+    void countChanged();
+    void filterByActivityChanged();
+    void filterByScreenChanged();
+    void filterByVirtualDesktopChanged();
+    void groupingAppIdBlacklistChanged();
+    void groupingLauncherUrlBlacklistChanged();
+    void launcherCountChanged();
+    void launcherListChanged();
+    void screenGeometryChanged();
+    void settingsChanged();
+    void sharingKeyChanged();
+    void virtualDesktopChanged();
+
+    //! the launchers of the model changed and this plasmoid must store them,
+    //! either because it changed them or because it is the first plasmoid
+    //! of a shared model whose launchers were changed by the model itself
+    void persistLaunchersRequested();
+
+protected:
+    bool filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const override;
+
+private slots:
+    void onLauncherListChanged();
+    void onRowsChanged(const QModelIndex &parent);
+    void onSourceDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QVector<int> &roles);
+    void onSourceRowsChanged();
+
+    void updateAnyTaskDemandsAttention();
+    void updateCount();
+
+private:
+    bool acceptsEntry(const QModelIndex &sourceIndex) const;
+    bool acceptsTask(const QModelIndex &sourceIndex) const;
+    bool filterIsCurrent(const QModelIndex &sourceIndex) const;
+    bool isFiltering() const;
+    bool isLauncherSlot(const QModelIndex &sourceIndex) const;
+    bool launcherTakesPlace(const QModelIndex &sourceIndex) const;
+    bool persistsLaunchers() const;
+
+    void applyBlacklists(TaskManager::TasksModel *model) const;
+    void applyCurrentState(TaskManager::TasksModel *model) const;
+    void applySettings(TaskManager::TasksModel *model) const;
+    void connectModel();
+    void invalidateTasksFilter();
+    void release();
+    void updateLauncherSlots();
+    void updateModel();
+    void updateRoles();
+
+    QModelIndex sourceTaskIndex(const QModelIndex &index) const;
+    QModelIndex windowIndex(const QModelIndex &index) const;
+
+    QString poolKey() const;
+
+private:
+    bool m_anyTaskDemandsAttention{false};
+    bool m_componentComplete{false};
+    bool m_filterByActivity{false};
+    bool m_filterByScreen{false};
+    bool m_filterByVirtualDesktop{false};
+
+    int m_count{0};
+
+    QString m_activity;
+    QString m_sharingKey;
+    //! the key of the model in the pool, empty for a model of its own
+    QString m_poolKey;
+
+    QStringList m_groupingAppIdBlacklist;
+    QStringList m_groupingLauncherUrlBlacklist;
+
+    QRect m_screenGeometry;
+
+    QVariant m_virtualDesktop;
+    QVariantMap m_settings;
+
+    //! shared model rows that are shown as launchers because all their windows are filtered out
+    QSet<QPersistentModelIndex> m_launcherSlots;
+
+    //! the roles are resolved by name because they differ between plasma versions
+    struct Roles {
+        int activities{-1};
+        int childCount{-1};
+        int isActive{-1};
+        int isDemandingAttention{-1};
+        int isGroupParent{-1};
+        int isLauncher{-1};
+        int isMinimized{-1};
+        int isOnAllVirtualDesktops{-1};
+        int isStartup{-1};
+        int isWindow{-1};
+        int launcherUrlWithoutIcon{-1};
+        int legacyWinIdList{-1};
+        int screenGeometry{-1};
+        int virtualDesktop{-1};
+        int virtualDesktops{-1};
+        int winIdList{-1};
+    } m_roles;
+
+    QPointer<TaskManager::TasksModel> m_model;
+};
+
+}
+
+#endif
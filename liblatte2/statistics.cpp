@@ -0,0 +1,109 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "statistics.h"
+
+// local
+#include "commontools.h"
+
+namespace Latte {
+
+namespace {
+const char SharedStatisticsProperty[] = "_latte_statistics";
+}
+
+Statistics::Statistics()
+{
+    for (auto &counter : m_counters) {
+        counter.store(0);
+    }
+}
+
+Statistics::~Statistics()
+{
+}
+
+Statistics *Statistics::self()
+{
+    static Statistics *s_statistics = nullptr;
+
+    if (!s_statistics) {
+        Statistics *created = new Statistics();
+        s_statistics = static_cast<Statistics *>(sharedInstance(SharedStatisticsProperty, created));
+
+        if (s_statistics != created) {
+            delete created;
+        }
+    }
+
+    return s_statistics;
+}
+
+QString Statistics::name(Counter counter)
+{
+    switch (counter) {
+        case WindowEventsReceived:
+            return QStringLiteral("windowEventsReceived");
+
+        case WindowEventsDelivered:
+            return QStringLiteral("windowEventsDelivered");
+
+        case RequestInfoCalls:
+            return QStringLiteral("requestInfoCalls");
+
+        case UpdateFlagsRuns:
+            return QStringLiteral("updateFlagsRuns");
+
+        case ConfigWrites:
+            return QStringLiteral("configWrites");
+
+        case ConfigWritesSkipped:
+            return QStringLiteral("configWritesSkipped");
+
+        case MaskUpdates:
+            return QStringLiteral("maskUpdates");
+
+        case MaskRegionsHits:
+            return QStringLiteral("maskRegionsHits");
+
+        case MaskRegionsMisses:
+            return QStringLiteral("maskRegionsMisses");
+
+        case IconLoads:
+            return QStringLiteral("iconLoads");
+
+        case IconColorsHits:
+            return QStringLiteral("iconColorsHits");
+
+        case IconColorsMisses:
+            return QStringLiteral("iconColorsMisses");
+
+        case BackgroundHintsHits:
+            return QStringLiteral("backgroundHintsHits");
+
+        case BackgroundHintsMisses:
+            return QStringLiteral("backgroundHintsMisses");
+
+        default:
+            return QString();
+    }
+}
+
+}
@@ -0,0 +1,80 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef STATISTICS_H
+#define STATISTICS_H
+
+// Qt
+#include <QAtomicInteger>
+#include <QString>
+
+namespace Latte {
+
+//! It holds live counters of the hot paths for the whole session. The
+//! application and the qml plugin share the same counters through the
+//! application instance. Increasing a counter costs a relaxed atomic add.
+class Statistics
+{
+public:
+    enum Counter
+    {
+        WindowEventsReceived = 0,
+        WindowEventsDelivered,
+        RequestInfoCalls,
+        UpdateFlagsRuns,
+        ConfigWrites,
+        ConfigWritesSkipped,
+        MaskUpdates,
+        MaskRegionsHits,
+        MaskRegionsMisses,
+        IconLoads,
+        IconColorsHits,
+        IconColorsMisses,
+        BackgroundHintsHits,
+        BackgroundHintsMisses,
+        CountersCount
+    };
+
+    static Statistics *self();
+
+    inline void increase(Counter counter) {
+        m_counters[counter].fetchAndAddRelaxed(1);
+    }
+
+    inline quint64 value(Counter counter) const {
+        return m_counters[counter].load();
+    }
+
+    //! the name that is used for the counter in reports, e.g. "windowEventsReceived"
+    static QString name(Counter counter);
+
+private:
+    Statistics();
+    ~Statistics();
+
+private:
+    QAtomicInteger<quint64> m_counters[CountersCount];
+};
+
+}
+
+#define LATTE_COUNT(counter) Latte::Statistics::self()->increase(Latte::Statistics::counter)
+
+#endif
@@ -0,0 +1,180 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "tracer.h"
+
+// local
+#include "commontools.h"
+
+// Qt
+#include <QCoreApplication>
+#include <QDebug>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMutexLocker>
+#include <QThread>
+
+namespace Latte {
+
+namespace {
+const char SharedTracerProperty[] = "_latte_tracer";
+}
+
+Tracer::Tracer()
+{
+    m_clock.start();
+}
+
+Tracer::~Tracer()
+{
+}
+
+Tracer *Tracer::self()
+{
+    static Tracer *s_tracer = nullptr;
+
+    if (!s_tracer) {
+        Tracer *created = new Tracer();
+        s_tracer = static_cast<Tracer *>(sharedInstance(SharedTracerProperty, created));
+
+        if (s_tracer != created) {
+            delete created;
+        }
+    }
+
+    return s_tracer;
+}
+
+QString Tracer::file() const
+{
+    return m_file;
+}
+
+qint64 Tracer::now() const
+{
+    return m_clock.nsecsElapsed() / 1000;
+}
+
+bool Tracer::start(const QString &file)
+{
+    if (file.isEmpty()) {
+        return false;
+    }
+
+    if (isRunning()) {
+        stop();
+    }
+
+    QMutexLocker locker(&m_mutex);
+
+    m_file = file;
+    m_events.clear();
+    m_droppedEvents = 0;
+    m_running.storeRelease(1);
+
+    qDebug() << "Tracer, recording trace to ::: " << m_file;
+
+    return true;
+}
+
+bool Tracer::stop()
+{
+    if (!isRunning()) {
+        return false;
+    }
+
+    m_running.storeRelease(0);
+
+    return write();
+}
+
+void Tracer::addSpan(const char *category, const char *name, qint64 start, qint64 duration)
+{
+    QMutexLocker locker(&m_mutex);
+
+    if (!isRunning()) {
+        return;
+    }
+
+    if (m_events.size() >= MaxEvents) {
+        m_droppedEvents++;
+        return;
+    }
+
+    Event event;
+    event.category = category;
+    event.name = name;
+    event.start = start;
+    event.duration = duration;
+    event.thread = static_cast<qint64>(reinterpret_cast<quintptr>(QThread::currentThreadId()));
+
+    m_events.append(event);
+}
+
+bool Tracer::write()
+{
+    QMutexLocker locker(&m_mutex);
+
+    const qint64 pid = QCoreApplication::applicationPid();
+
+    QJsonArray events;
+
+    for (const auto &event : m_events) {
+        QJsonObject jevent;
+        jevent[QStringLiteral("name")] = QString::fromLatin1(event.name);
+        jevent[QStringLiteral("cat")] = QString::fromLatin1(event.category);
+        jevent[QStringLiteral("ph")] = QStringLiteral("X");
+        jevent[QStringLiteral("ts")] = event.start;
+        jevent[QStringLiteral("dur")] = event.duration;
+        jevent[QStringLiteral("pid")] = pid;
+        jevent[QStringLiteral("tid")] = event.thread;
+
+        events.append(jevent);
+    }
+
+    QJsonObject trace;
+    trace[QStringLiteral("traceEvents")] = events;
+    trace[QStringLiteral("displayTimeUnit")] = QStringLiteral("ms");
+
+    if (m_droppedEvents > 0) {
+        QJsonObject metadata;
+        metadata[QStringLiteral("droppedEvents")] = m_droppedEvents;
+        trace[QStringLiteral("otherData")] = metadata;
+    }
+
+    m_events.clear();
+
+    QFile file(m_file);
+
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qWarning() << "Tracer, trace file can not be written ::: " << m_file;
+        return false;
+    }
+
+    file.write(QJsonDocument(trace).toJson(QJsonDocument::Compact));
+
+    qDebug() << "Tracer, trace was written to ::: " << m_file;
+
+    return true;
+}
+
+}
@@ -0,0 +1,123 @@
+/*
+*  Copyright 2018  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef TRACER_H
+#define TRACER_H
+
+// Qt
+#include <QAtomicInt>
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QString>
+#include <QVector>
+
+namespace Latte {
+
+//! It records scoped spans of the hot paths and writes them in the Chrome trace
+//! event format, the file can be opened with chrome://tracing or Perfetto.
+//! The application and the qml plugin share the same tracer through the
+//! application instance, so the plugin spans end up in the same trace.
+//! When tracing is not running a span costs just an atomic read
+class Tracer
+{
+public:
+    static Tracer *self();
+
+    inline bool isRunning() const {
+        return m_running.loadAcquire() == 1;
+    }
+
+    //! it starts recording, the events are written in the file when it stops
+    bool start(const QString &file);
+    //! it stops recording and writes the trace file
+    bool stop();
+
+    QString file() const;
+
+    //! microseconds since the tracer was created
+    qint64 now() const;
+
+    void addSpan(const char *category, const char *name, qint64 start, qint64 duration);
+
+private:
+    Tracer();
+    ~Tracer();
+
+    bool write();
+
+private:
+    struct Event {
+        const char *category;
+        const char *name;
+        qint64 start;
+        qint64 duration;
+        qint64 thread;
+    };
+
+    //! the recorded events are capped in order to not exhaust memory
+    //! when a trace is left running for too long
+    static const int MaxEvents = 1000000;
+
+    QAtomicInt m_running{0};
+    int m_droppedEvents{0};
+
+    QElapsedTimer m_clock;
+    QMutex m_mutex;
+    QString m_file;
+    QVector<Event> m_events;
+};
+
+//! It records the time spent in its scope, the category and name must be
+//! string literals because only their pointers are kept
+class TraceSpan
+{
+public:
+    inline TraceSpan(const char *category, const char *name)
+        : m_category(category),
+          m_name(name)
+    {
+        Tracer *tracer = Tracer::self();
+
+        if (tracer->isRunning()) {
+            m_tracer = tracer;
+            m_start = tracer->now();
+        }
+    }
+
+    inline ~TraceSpan() {
+        if (m_tracer) {
+            m_tracer->addSpan(m_category, m_name, m_start, m_tracer->now() - m_start);
+        }
+    }
+
+private:
+    Tracer *m_tracer{nullptr};
+    const char *m_category;
+    const char *m_name;
+    qint64 m_start{0};
+};
+
+}
+
+#define LATTE_TRACE_CONCAT_(a, b) a##b
+#define LATTE_TRACE_CONCAT(a, b) LATTE_TRACE_CONCAT_(a, b)
+#define LATTE_TRACE_SCOPE(category, name) Latte::TraceSpan LATTE_TRACE_CONCAT(latteTraceSpan, __LINE__)(category, name)
+
+#endif
@@ -95,7 +95,7 @@ Item {
     //!outside the latte plasmoid
     function updateIdSendScale(index, zScale, zStep){
         if ((index>=0 && index<=root.tasksCount-1) || (!root.latteView)){
-            root.updateScale(index, zScale, zStep);
+            parabolicEngine.updateScale(index, zScale, zStep);
             return -1;
         } else{
             var appletId = latteView.latteAppletPos;
@@ -111,42 +111,14 @@ Item {
         }
     }
 
+    //! the neighbour scales are computed and delivered by parabolicEngine, the
+    //! index mapping for separators, hidden tasks and outside applets stays here
     function applyParabolicEffect(index, currentMousePosition, center) {
-        var rDistance = Math.abs(currentMousePosition  - center);
+        var reversed = (Qt.application.layoutDirection === Qt.RightToLeft && !root.vertical);
+        var scales = parabolicEngine.neighbourScales(currentMousePosition, center, reversed);
 
-        //check if the mouse goes right or down according to the center
-        var positiveDirection =  ((currentMousePosition  - center) >= 0 );
-
-        if (Qt.application.layoutDirection === Qt.RightToLeft && !root.vertical) {
-            positiveDirection = !positiveDirection;
-        }
-
-        var minimumZoom = 1;
-
-        //finding the zoom center e.g. for zoom:1.7, calculates 0.35
-        var zoomCenter = ((root.zoomFactor + minimumZoom)/2) - 1;
-
-        //computes the in the scale e.g. 0...0.35 according to the mouse distance
-        //0.35 on the edge and 0 in the center
-        var firstComputation = (rDistance / center) * (zoomCenter-minimumZoom+1);
-
-        //calculates the scaling for the neighbour tasks
-        var bigNeighbourZoom = Math.min(1 + zoomCenter + firstComputation, root.zoomFactor);
-        var smallNeighbourZoom = Math.max(1 + zoomCenter - firstComputation, minimumZoom);
-
-        //bigNeighbourZoom = Number(bigNeighbourZoom.toFixed(4));
-        //smallNeighbourZoom = Number(smallNeighbourZoom.toFixed(4));
-
-        var leftScale;
-        var rightScale;
-
-        if(positiveDirection === true){
-            rightScale = bigNeighbourZoom;
-            leftScale = smallNeighbourZoom;
-        } else {
-            rightScale = smallNeighbourZoom;
-            leftScale = bigNeighbourZoom;
-        }
+        var leftScale = scales.leftScale;
+        var rightScale = scales.rightScale;
 
         // console.debug(leftScale + "  " + rightScale + " " + index);
 
@@ -210,15 +182,13 @@ Item {
 
     function clearTasksGreaterThan(index) {
         if (index<root.tasksCount-1){
-            for(var i=index+1; i<root.tasksCount; ++i)
-                root.updateScale(i, 1, 0);
+            parabolicEngine.clearScalesGreaterThan(index);
         }
     }
 
     function clearTasksLowerThan(index) {
         if (index>0 && root.tasksCount>2) {
-            for(var i=0; i<index; ++i)
-                root.updateScale(i, 1, 0);
+            parabolicEngine.clearScalesLowerThan(index);
         }
     }
 
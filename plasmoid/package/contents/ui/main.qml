@@ -90,6 +90,7 @@ Item {
 
     property int position : PlasmaCore.Types.BottomPositioned
     property int tasksStarting: 0
+    property bool tasksModelInitialized: false
     property int realSize: iconSize + iconMargin
 
     ///Don't use Math.floor it adds one pixel in animations and creates glitches
@@ -144,6 +145,7 @@ Item {
 
     //BEGIN Latte Dock properties
     property bool dockIsShownCompletely: latteView ? latteView.dockIsShownCompletely : true
+    property bool dockResourcesReleased: latteView ? latteView.dockResourcesReleased : false
     property bool enableShadows: latteView ? latteView.enableShadows > 0 : plasmoid.configuration.showShadows
     property bool forceHidePanel: false
     property bool directRenderDelayerIsRunning: latteView ? latteView.directRenderDelayerIsRunning : directRenderDelayerForEnteringTimer.running
@@ -223,15 +225,33 @@ Item {
     property string appShadowColor: latteView ? latteView.appShadowColor : "#ff080808"
     property string appShadowColorSolid: latteView ? latteView.appShadowColorSolid : "#ff080808"
 
-    property alias tasksCount: tasksModel.count
+    property int tasksCount: tasksModel ? tasksModel.count : 0
     property alias hoveredIndex: icList.hoveredIndex
 
     property QtObject currentLayout : latteView && latteView.managedLayout ? latteView.managedLayout : null
 
+    //! the shared launchers store of the layout or the global launchers
+    property QtObject launchersStore: {
+        if (latteView && currentLayout && latteView.universalSettings) {
+            if (latteView.launchersGroup === Latte.Types.LayoutLaunchers) {
+                return currentLayout.launchersStore;
+            } else if (latteView.launchersGroup === Latte.Types.GlobalLaunchers) {
+                return latteView.universalSettings.launchersStore;
+            }
+        }
+
+        return null;
+    }
+
     property var badgesForActivate: latteView ? latteView.badgesForActivate : []
     property var managedLayoutName: currentLayout ? currentLayout.name : ""
 
     property Item latteView: null
+
+    //! plasmoids that show the same synced launchers with the same settings filter
+    //! the same source model, it is also read from c++ side in order to identify them
+    readonly property QtObject tasksModel: sharedTasksModel
+    property QtObject appletEndpoints: latteView && latteView.universalLayoutManager ? latteView.universalLayoutManager.appletEndpoints : null
     //END Latte Dock Panel properties
 
     //BEGIN Latte Dock Communicator
@@ -283,6 +303,13 @@ Item {
             plasmoid.configuration.isInLatteDock = false;
     }
 
+    //! register the extSignal* and updateBadge functions to c++ side
+    onAppletEndpointsChanged: {
+        if (appletEndpoints) {
+            appletEndpoints.registerTasksPlasmoid(root);
+        }
+    }
+
 
     Connections {
         target: plasmoid
@@ -292,15 +319,6 @@ Item {
         }
     }
 
-    Connections {
-        target: plasmoid.configuration
-
-        // onLaunchersChanged: tasksModel.launcherList = plasmoid.configuration.launchers
-        onGroupingAppIdBlacklistChanged: tasksModel.groupingAppIdBlacklist = plasmoid.configuration.groupingAppIdBlacklist;
-        onGroupingLauncherUrlBlacklistChanged: tasksModel.groupingLauncherUrlBlacklist = plasmoid.configuration.groupingLauncherUrlBlacklist;
-    }
-
-
     Connections{
         target: latteView
         onDockIsHiddenChanged:{
@@ -311,7 +329,7 @@ Item {
 
         onLaunchersGroupChanged:{
             if( latteView && latteView.editMode) {
-                tasksModel.updateLaunchersList();
+                root.updateLaunchersList();
             }
         }
     }
@@ -351,7 +369,11 @@ Item {
 
     ///UPDATE
     function launcherExists(url) {
-        return (ActivitiesTools.getIndex(url, tasksModel.launcherList)>=0);
+        if (launchersStore) {
+            return launchersStore.contains(url);
+        }
+
+        return (tasksModel.launcherPosition(url) >= 0);
     }
 
     function taskExists(url) {
@@ -425,7 +447,7 @@ Item {
         for(var i=0; i<tasks.length; ++i){
             var task = icList.childAtIndex(i);
 
-            if (task!==undefined && task.launcherUrl!=="" && tasksModel.launcherInCurrentActivity(task.launcherUrl)) {
+            if (task!==undefined && task.launcherUrl!=="" && root.launcherInCurrentActivity(task.launcherUrl)) {
                 launch.push(task.launcherUrl);
             }
         }
@@ -499,6 +521,9 @@ Item {
         windowsPreviewDlg.hide(11);
     }
 
+    //! scale updates reach only the task that they are meant for
+    onUpdateScale: parabolicEngine.updateScale(delegateIndex, newScale, step);
+
     onDragSourceChanged: {
         if (dragSource == null) {
             root.draggingFinished();
@@ -663,61 +688,68 @@ Item {
 
     onCurrentLayoutChanged: {
         if (currentLayout && !loadLaunchersFirstTime) {
-            tasksModel.updateLaunchersList();
+            root.updateLaunchersList();
             loadLaunchersFirstTime = true;
         }
     }
 
-    TaskManager.TasksModel {
-        id: tasksModel
+    Latte.SharedTasksModel {
+        id: sharedTasksModel
+
+        sharingKey: {
+            if (latteView && currentLayout && latteView.universalSettings) {
+                if (latteView.launchersGroup === Latte.Types.LayoutLaunchers) {
+                    return "layout:" + currentLayout.name;
+                } else if (latteView.launchersGroup === Latte.Types.GlobalLaunchers) {
+                    return "global";
+                }
+            }
+
+            return "";
+        }
 
         virtualDesktop: virtualDesktopInfo.currentDesktop
         screenGeometry: plasmoid.screenGeometry
-        // comment in order to support LTS Plasma 5.8
-        // screen: plasmoid.screen
         activity: activityInfo.currentActivity
 
         filterByVirtualDesktop: root.showOnlyCurrentDesktop
         filterByScreen: root.showOnlyCurrentScreen
         filterByActivity: root.showOnlyCurrentActivity
 
-        launchInPlace: true
-        separateLaunchers: true
-        groupInline: false
+        groupingAppIdBlacklist: plasmoid.configuration.groupingAppIdBlacklist
+        groupingLauncherUrlBlacklist: plasmoid.configuration.groupingLauncherUrlBlacklist
 
-        groupMode: groupTasksByDefault ? TaskManager.TasksModel.GroupApplications : TaskManager.TasksModel.GroupDisabled
-        sortMode: TaskManager.TasksModel.SortManual
+        settings: {
+            var modelSettings = {
+                "launchInPlace": true,
+                "separateLaunchers": true,
+                "groupInline": false,
+                "groupMode": groupTasksByDefault ? TaskManager.TasksModel.GroupApplications : TaskManager.TasksModel.GroupDisabled,
+                "sortMode": TaskManager.TasksModel.SortManual
+            };
 
-        function updateLaunchersList(){
-            if (latteView.universalSettings
-                    && (latteView.launchersGroup === Latte.Types.LayoutLaunchers
-                        || latteView.launchersGroup === Latte.Types.GlobalLaunchers)) {
-                if (latteView.launchersGroup === Latte.Types.LayoutLaunchers) {
-                    tasksModel.launcherList = latteView.managedLayout.launchers;
-                } else if (latteView.launchersGroup === Latte.Types.GlobalLaunchers) {
-                    tasksModel.launcherList = latteView.universalSettings.launchers;
-                }
-            } else {
-                tasksModel.launcherList = plasmoid.configuration.launchers59;
+            ///Plasma 5.9 enforce grouping at all cases
+            if (Latte.WindowSystem.plasmaDesktopVersion >= Latte.WindowSystem.makeVersion(5,9,0)) {
+                modelSettings["groupingWindowTasksThreshold"] = -1;
             }
-        }
 
-        function launcherInCurrentActivity(url) {
-            var activities = tasksModel.launcherActivities(url);
-
-            var NULL_UUID = "00000000-0000-0000-0000-000000000000";
+            return modelSettings;
+        }
 
-            if (activities.indexOf(NULL_UUID) !== -1 || activities.indexOf(activityInfo.currentActivity) !== -1)
-                return true;
+        onSourceModelChanged: initializeTasksModel();
+    }
 
-            return false;
-        }
+    Connections {
+        target: tasksModel
 
         onActivityChanged: {
-            ActivitiesTools.currentActivity = String(activity);
+            ActivitiesTools.currentActivity = String(tasksModel.activity);
         }
 
-        onLauncherListChanged: {
+        //! only the plasmoid that changed the launchers of a shared model stores them
+        onPersistLaunchersRequested: {
+            var launcherList = tasksModel.launcherList;
+
             if (currentLayout) {
                 if (latteView && latteView.universalLayoutManager
                         && latteView.managedLayout && latteView.universalSettings
@@ -747,53 +779,19 @@ Item {
         }
 
         onGroupingAppIdBlacklistChanged: {
-            plasmoid.configuration.groupingAppIdBlacklist = groupingAppIdBlacklist;
+            plasmoid.configuration.groupingAppIdBlacklist = tasksModel.groupingAppIdBlacklist;
         }
 
         onGroupingLauncherUrlBlacklistChanged: {
-            plasmoid.configuration.groupingLauncherUrlBlacklist = groupingLauncherUrlBlacklist;
+            plasmoid.configuration.groupingLauncherUrlBlacklist = tasksModel.groupingLauncherUrlBlacklist;
         }
 
         onAnyTaskDemandsAttentionChanged: {
-            if (anyTaskDemandsAttention){
+            if (tasksModel.anyTaskDemandsAttention){
                 plasmoid.status = PlasmaCore.Types.RequiresAttentionStatus;
                 attentionTimerComponent.createObject(root);
             }
         }
-
-
-        Component.onCompleted: {
-            ActivitiesTools.launchersOnActivities = root.launchersOnActivities
-            ActivitiesTools.currentActivity = String(activityInfo.currentActivity);
-            ActivitiesTools.plasmoid = plasmoid;
-
-            //var loadedLaunchers = ActivitiesTools.restoreLaunchers();
-            ActivitiesTools.importLaunchersToNewArchitecture();
-
-            if (currentLayout && latteView.universalSettings
-                    && (latteView.launchersGroup === Latte.Types.LayoutLaunchers
-                        || latteView.launchersGroup === Latte.Types.GlobalLaunchers)) {
-
-                if (latteView.launchersGroup === Latte.Types.LayoutLaunchers) {
-                    launcherList = latteView.managedLayout.launchers;
-                } else if (latteView.launchersGroup === Latte.Types.GlobalLaunchers) {
-                    launcherList = latteView.universalSettings.launchers;
-                }
-            } else {
-                launcherList = plasmoid.configuration.launchers59;
-            }
-
-            groupingAppIdBlacklist = plasmoid.configuration.groupingAppIdBlacklist;
-            groupingLauncherUrlBlacklist = plasmoid.configuration.groupingLauncherUrlBlacklist;
-
-            icList.model = tasksModel;
-            tasksStarting = count;
-
-            ///Plasma 5.9 enforce grouping at all cases
-            if (Latte.WindowSystem.plasmaDesktopVersion >= Latte.WindowSystem.makeVersion(5,9,0)) {
-                groupingWindowTasksThreshold = -1;
-            }
-        }
     }
 
     //! TaskManagerBackend required a groupDialog setting otherwise it crashes. This patch
@@ -936,6 +934,11 @@ Item {
         id: _parabolicManager
     }
 
+    Latte.ParabolicEngine{
+        id: parabolicEngine
+        zoomFactor: root.zoomFactor
+    }
+
     /*  IconsModel{
         id: iconsmdl
     }*/
@@ -1197,7 +1200,7 @@ Item {
             property int hoveredIndex : -1
             property int previousCount : 0
 
-            property int tasksCount: tasksModel.count
+            property int tasksCount: root.tasksCount
 
             property bool directRender: false
 
@@ -1698,6 +1701,65 @@ Item {
         }
     }
 
+    //! it is called for every source model that the plasmoid filters, a shared
+    //! model already contains the same launchers and assigning them is a no-op
+    function initializeTasksModel() {
+        if (!tasksModel.sourceModel) {
+            return;
+        }
+
+        if (!tasksModelInitialized) {
+            ActivitiesTools.launchersOnActivities = root.launchersOnActivities
+            ActivitiesTools.currentActivity = String(activityInfo.currentActivity);
+            ActivitiesTools.plasmoid = plasmoid;
+
+            //var loadedLaunchers = ActivitiesTools.restoreLaunchers();
+            ActivitiesTools.importLaunchersToNewArchitecture();
+        }
+
+        if (currentLayout) {
+            updateLaunchersList();
+        } else {
+            tasksModel.launcherList = plasmoid.configuration.launchers59;
+        }
+
+        icList.model = tasksModel;
+
+        if (!tasksModelInitialized) {
+            tasksStarting = tasksModel.count;
+            tasksModelInitialized = true;
+        }
+    }
+
+    function updateLaunchersList(){
+        if (latteView.universalSettings
+                && (latteView.launchersGroup === Latte.Types.LayoutLaunchers
+                    || latteView.launchersGroup === Latte.Types.GlobalLaunchers)) {
+            if (latteView.launchersGroup === Latte.Types.LayoutLaunchers) {
+                tasksModel.launcherList = latteView.managedLayout.launchers;
+            } else if (latteView.launchersGroup === Latte.Types.GlobalLaunchers) {
+                tasksModel.launcherList = latteView.universalSettings.launchers;
+            }
+        } else {
+            tasksModel.launcherList = plasmoid.configuration.launchers59;
+        }
+    }
+
+    function launcherInCurrentActivity(url) {
+        if (root.launchersStore) {
+            return root.launchersStore.isOnActivity(url, activityInfo.currentActivity);
+        }
+
+        var activities = tasksModel.launcherActivities(url);
+
+        var NULL_UUID = "00000000-0000-0000-0000-000000000000";
+
+        if (activities.indexOf(NULL_UUID) !== -1 || activities.indexOf(activityInfo.currentActivity) !== -1)
+            return true;
+
+        return false;
+    }
+
     function getLauncherList() {
         return plasmoid.configuration.launchers59;
     }
@@ -1967,6 +2029,10 @@ Item {
     }
 
     Component.onDestruction: {
+        if (appletEndpoints) {
+            appletEndpoints.unregisterEndpoint(root);
+        }
+
         root.presentWindows.disconnect(backend.presentWindows);
         root.windowsHovered.disconnect(backend.windowsHovered);
         dragHelper.dropped.disconnect(resetDragSource);
@@ -1273,7 +1273,7 @@ MouseArea{
     function updateVisibilityBasedOnLaunchers(){
         var launcherExists = !(((tasksModel.launcherPosition(taskItem.launcherUrl) == -1)
                                 && (tasksModel.launcherPosition(taskItem.launcherUrlWithIcon) == -1) )
-                               || !tasksModel.launcherInCurrentActivity(taskItem.launcherUrl));
+                               || !root.launcherInCurrentActivity(taskItem.launcherUrl));
 
         if (root.showWindowsOnlyFromLaunchers) {
             var hideWindow =  !launcherExists && taskItem.isWindow;
@@ -1365,7 +1365,7 @@ MouseArea{
                                 || (tasksModel.launcherPosition(taskItem.launcherUrlWithIcon) !== -1) );
 
         //startup without launcher
-        var hideStartup =  ((!hasShownLauncher || !tasksModel.launcherInCurrentActivity(taskItem.launcherUrl))
+        var hideStartup =  ((!hasShownLauncher || !root.launcherInCurrentActivity(taskItem.launcherUrl))
                             && taskItem.isStartup);
 
         if (!Latte.WindowSystem.compositingActive) {
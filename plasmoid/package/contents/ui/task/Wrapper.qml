@@ -312,6 +312,11 @@ Item{
         }
     }
 
+    Connections {
+        target: taskItem
+        onItemIndexChanged: parabolicEngine.registerItem(taskItem.itemIndex, wrapper, "mScale");
+    }
+
     onMScaleChanged: {
         if ((mScale === root.zoomFactor) && !root.directRenderTimerIsRunning && !root.globalDirectRender) {
             root.setGlobalDirectRender(true);
@@ -344,10 +349,10 @@ Item{
             opacity = 1;
         }
 
-        root.updateScale.connect(signalUpdateScale);
+        parabolicEngine.registerItem(taskItem.itemIndex, wrapper, "mScale");
     }
 
     Component.onDestruction: {
-        root.updateScale.disconnect(signalUpdateScale);
+        parabolicEngine.unregisterItem(wrapper);
     }
 }// Main task area // id:wrapper
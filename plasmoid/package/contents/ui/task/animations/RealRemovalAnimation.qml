@@ -35,7 +35,7 @@ SequentialAnimation {
     //Animation Add/Remove (4) - the user removes a launcher, animation enabled
     property bool animation1: ((((tasksModel.launcherPosition(taskItem.launcherUrl) === -1)
                                  && (tasksModel.launcherPosition(taskItem.launcherUrlWithIcon) === -1) )
-                                || !tasksModel.launcherInCurrentActivity(taskItem.launcherUrl))
+                                || !root.launcherInCurrentActivity(taskItem.launcherUrl))
                                && !taskItem.isStartup && Latte.WindowSystem.compositingActive)
 
     property bool animation4: ((taskItem.launcherUrl===root.launcherForRemoval
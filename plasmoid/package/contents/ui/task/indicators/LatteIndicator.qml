@@ -73,6 +73,7 @@ Item{
                 contrastColor: root.appShadowColorSolid
                 attentionColor: colorScopePalette.negativeTextColor
 
+                animationsPaused: root.dockResourcesReleased
                 roundCorners: true
                 showAttention: taskItem.showAttention
                 showGlow: {